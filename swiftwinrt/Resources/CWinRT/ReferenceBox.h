@@ -0,0 +1,33 @@
+// IReference<T> for any T. The vtables of the IReference<T> instantiations only differ in the type which
+// get_Value writes out, so the values boxed by the support module implement all of them with this one.
+
+#include <inspectable.h>
+
+typedef interface IReferenceBox IReferenceBox;
+
+typedef struct IReferenceBoxVtbl
+{
+    BEGIN_INTERFACE
+
+    HRESULT (STDMETHODCALLTYPE* QueryInterface)(__RPC__in IReferenceBox* This,
+        REFIID riid,
+        _COM_Outptr_ void** ppvObject);
+    ULONG (STDMETHODCALLTYPE* AddRef)(__RPC__in IReferenceBox* This);
+    ULONG (STDMETHODCALLTYPE* Release)(__RPC__in IReferenceBox* This);
+    HRESULT (STDMETHODCALLTYPE* GetIids)(__RPC__in IReferenceBox* This,
+        __RPC__out ULONG* iidCount,
+        __RPC__deref_out_ecount_full_opt(*iidCount) IID** iids);
+    HRESULT (STDMETHODCALLTYPE* GetRuntimeClassName)(__RPC__in IReferenceBox* This,
+        __RPC__deref_out_opt HSTRING* className);
+    HRESULT (STDMETHODCALLTYPE* GetTrustLevel)(__RPC__in IReferenceBox* This,
+        __RPC__out TrustLevel* trustLevel);
+    HRESULT (STDMETHODCALLTYPE* get_Value)(__RPC__in IReferenceBox* This,
+        __RPC__out void* value);
+
+    END_INTERFACE
+} IReferenceBoxVtbl;
+
+interface IReferenceBox
+{
+    CONST_VTBL struct IReferenceBoxVtbl* lpVtbl;
+};
@@ -0,0 +1,75 @@
+import WinSDK
+import CWinRT
+
+/// Activation factories shared by every class in the process, used by projections generated with `-factory-cache`.
+///
+/// Generated classes still keep each factory interface in a `static let`, so this is only consulted the first time
+/// a class uses one of them. What it adds is sharing between those first uses:
+/// - `prewarm(_:)` resolves the factories of a list of classes ahead of time, i.e. from a background thread during
+///   startup, which moves the DLL loads and activation catalog lookups off of the thread which activates them. The
+///   agile ones are kept and used by those classes whether or not `reuseAgileFactories` is set.
+/// - With `reuseAgileFactories` set, every class's activation factory is resolved once and, when it is agile, kept and
+///   queried for each of the class's factory and statics interfaces rather than calling `RoGetActivationFactory`
+///   once per interface. Factories which aren't agile belong to the apartment they were created in and are never kept.
+public enum ActivationFactoryCache {
+    /// Off by default, set it before the first class is activated.
+    public static var reuseAgileFactories: Bool {
+        get { activationFactoriesLock.withLock(.shared) { reuseAgileActivationFactories } }
+        set { activationFactoriesLock.withLock(.exclusive) { reuseAgileActivationFactories = newValue } }
+    }
+
+    public static func factory<Factory: IInspectable>(_ activatableClassId: StaticString) throws -> Factory {
+        let name = String(describing: activatableClassId)
+        if let cached = cachedActivationFactory(name) {
+            return try cached.QueryInterface()
+        }
+        guard reuseAgileFactories else {
+            return try RoGetActivationFactory(activatableClassId)
+        }
+        return try resolveActivationFactory(name).QueryInterface()
+    }
+
+    /// Resolves the activation factories of the given runtime classes and keeps the agile ones. Failures are ignored,
+    /// the class reports them when it is first used.
+    public static func prewarm(_ activatableClassIds: [String]) {
+        for activatableClassId in activatableClassIds where cachedActivationFactory(activatableClassId) == nil {
+            _ = try? resolveActivationFactory(activatableClassId)
+        }
+    }
+
+    /// Whether the activation factory of the given runtime class is kept.
+    @_spi(WinRTInternal)
+    public static func isKept(_ activatableClassId: String) -> Bool {
+        cachedActivationFactory(activatableClassId) != nil
+    }
+
+    /// Lets go of every kept factory and turns `reuseAgileFactories` back off, so that tests start from scratch.
+    @_spi(WinRTInternal)
+    public static func reset() {
+        activationFactoriesLock.withLock(.exclusive) {
+            activationFactories.removeAll()
+            reuseAgileActivationFactories = false
+        }
+    }
+
+    private static func cachedActivationFactory(_ activatableClassId: String) -> IActivationFactory? {
+        activationFactoriesLock.withLock(.shared) { activationFactories[activatableClassId] }
+    }
+
+    private static func resolveActivationFactory(_ activatableClassId: String) throws -> IActivationFactory {
+        // Like the MakeFromAbi factory cache, concurrent threads may both resolve the same class. That's harmless,
+        // the last one to finish wins.
+        let factory: IActivationFactory = try RoGetActivationFactory(activatableClassId)
+        let agile: IAgileObject? = try? factory.QueryInterface()
+        if agile != nil {
+            activationFactoriesLock.withLock(.exclusive) {
+                activationFactories[activatableClassId] = factory
+            }
+        }
+        return factory
+    }
+}
+
+private var activationFactories: [String: IActivationFactory] = [:]
+private var reuseAgileActivationFactories = false
+private var activationFactoriesLock = SRWLock()
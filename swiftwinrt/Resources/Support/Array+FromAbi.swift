@@ -11,6 +11,20 @@ extension Array where Element: FromAbi {
     }
 }
 
+@_spi(WinRTInternal)
+extension Array where Element: WinRTBlittableStruct {
+    public static func from(abi: WinRTArrayAbi<Element.ABI>) -> [Element] {
+        let buffer = UnsafeBufferPointer(start: abi.start, count: Int(abi.count))
+        guard Element.hasAbiLayout, let start = buffer.baseAddress, !buffer.isEmpty else {
+            return buffer.map { .from(abi: $0) }
+        }
+        return Array(unsafeUninitializedCapacity: buffer.count) { elements, initializedCount in
+            UnsafeMutableRawPointer(elements.baseAddress!).copyMemory(from: start, byteCount: buffer.count * MemoryLayout<Element>.stride)
+            initializedCount = buffer.count
+        }
+    }
+}
+
 @_spi(WinRTInternal)
 extension Array where Element: Numeric {
     public static func from(abi: WinRTArrayAbi<Element>) -> [Element] {
@@ -41,3 +55,52 @@ extension Array {
         UnsafeBufferPointer(start: abi.1, count: Int(abi.0)).map { Bridge.from(abi: ComPtr($0)) }
     }
 }
+
+// Fill arrays, such as the items of GetMany, are buffers which the caller allocates and the callee writes elements
+// into. The caller owns each element written, so these pass an empty buffer and then take over the elements in it,
+// rather than marshaling the array in and adding a reference to, or copying, each element on the way out.
+@_spi(WinRTInternal)
+extension Array where Element == String {
+    public mutating func fillFromAbi(_ body: (WinRTArrayAbi<HSTRING?>) throws -> Void) throws {
+        var abi = [HSTRING?](repeating: nil, count: count)
+        defer {
+            for element in abi {
+                WindowsDeleteString(element)
+            }
+        }
+        try abi.withUnsafeMutableBufferPointer { try body((count: UInt32($0.count), start: $0.baseAddress)) }
+        self = abi.map { .from(abi: $0) }
+    }
+}
+
+@_spi(WinRTInternal)
+extension Array {
+    public mutating func fillFromAbi<Bridge: AbiInterfaceBridge>(abiBridge: Bridge.Type, _ body: (WinRTArrayAbi<UnsafeMutablePointer<Bridge.CABI>?>) throws -> Void) throws where Element == Bridge.SwiftProjection? {
+        var abi = [UnsafeMutablePointer<Bridge.CABI>?](repeating: nil, count: count)
+        do {
+            try abi.withUnsafeMutableBufferPointer { try body((count: UInt32($0.count), start: $0.baseAddress)) }
+        } catch {
+            for element in abi {
+                _ = ComPtr(consuming: element)
+            }
+            throw error
+        }
+        self = abi.map { InterfaceWrapperBase<Bridge>.unwrapFrom(abi: ComPtr(consuming: $0)) }
+    }
+}
+
+@_spi(WinRTInternal)
+extension Array {
+    public mutating func fillFromAbi<Bridge: AbiBridge>(abiBridge: Bridge.Type, _ body: (WinRTArrayAbi<UnsafeMutablePointer<Bridge.CABI>?>) throws -> Void) throws where Element == Bridge.SwiftProjection?, Bridge.SwiftProjection: WinRTClass {
+        var abi = [UnsafeMutablePointer<Bridge.CABI>?](repeating: nil, count: count)
+        do {
+            try abi.withUnsafeMutableBufferPointer { try body((count: UInt32($0.count), start: $0.baseAddress)) }
+        } catch {
+            for element in abi {
+                _ = ComPtr(consuming: element)
+            }
+            throw error
+        }
+        self = abi.map { Bridge.from(abi: ComPtr(consuming: $0)) }
+    }
+}
@@ -101,6 +101,16 @@ public var E_XAMLPARSEFAILED : WinSDK.HRESULT {
   HRESULT(bitPattern: 0x802B000A)
 }
 
+@_transparent
+public var TYPE_E_TYPEMISMATCH: WinSDK.HRESULT {
+  HRESULT(bitPattern: 0x80028CA0)
+}
+
+@_transparent
+public var DISP_E_OVERFLOW: WinSDK.HRESULT {
+  HRESULT(bitPattern: 0x8002000A)
+}
+
 private func hrToString(_ hr: HRESULT) -> String {
   let dwFlags: DWORD = DWORD(FORMAT_MESSAGE_ALLOCATE_BUFFER)
                        | DWORD(FORMAT_MESSAGE_FROM_SYSTEM)
@@ -24,6 +24,26 @@ public struct Event<Handler> {
     }
 }
 
+extension Event {
+    /// Creates an event which adds its handlers to a WinRT object. The handler is wrapped for the ABI here,
+    /// where it is still generic, rather than in a closure taking the concrete delegate type. Converting it
+    /// to and from the concrete function type would box it in a reabstraction thunk each way, so this way
+    /// the delegate wrapper is the only allocation made when adding a handler.
+    public init<Bridge: WinRTDelegateBridge>(
+        bridge: Bridge.Type,
+        add: @escaping (UnsafeMutablePointer<Bridge.CABI>?) throws -> EventRegistrationToken,
+        remove: @escaping (_ token: EventRegistrationToken) throws -> Void
+    ) where Bridge.Handler == Handler {
+        self.init(
+            add: { handler in
+                guard let wrapper = InterfaceWrapperBase<Bridge>(handler) else { return try! add(nil) }
+                return try! wrapper.toABI { try add($0) }
+            },
+            remove: { try? remove($0) }
+        )
+    }
+}
+
 public struct EventCleanup: Disposable {
     fileprivate let token: EventRegistrationToken
     let closeAction: (_ token: EventRegistrationToken) -> Void
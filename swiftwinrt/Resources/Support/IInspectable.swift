@@ -70,6 +70,8 @@ public enum __ABI_ {
         guard let abi = abi else { return nil }
         if let instance = tryUnwrapFrom(abi: abi) {
           if let weakRef = instance as? AnyObjectWrapper { return weakRef.obj }
+          // Values boxed on the Swift side come back as themselves, without going through IReference<T>
+          if let propertyValue = instance as? __IMPL_Windows_Foundation.IPropertyValueImpl { return propertyValue.value }
           return instance
         }
 
@@ -81,6 +83,20 @@ public enum __ABI_ {
         return tryUnwrapFromBase(raw: pUnk)
       }
 
+      // ComposableVTable is shared between all of the unsealed classes without an overrides interface, so it
+      // only knows the aggregating object through CustomAddRef
+      internal static func addRefAggregated(_ pUnk: UnsafeMutablePointer<C_IInspectable>?) -> ULONG {
+        guard let unmanaged = fromRaw(pUnk) else { return 1 }
+        (unmanaged._withUnsafeGuaranteedRef { $0.swiftObj } as? CustomAddRef)?.addRef()
+        return addRef(pUnk)
+      }
+
+      internal static func releaseAggregated(_ pUnk: UnsafeMutablePointer<C_IInspectable>?) -> ULONG {
+        guard let unmanaged = fromRaw(pUnk) else { return 1 }
+        (unmanaged._withUnsafeGuaranteedRef { $0.swiftObj } as? CustomAddRef)?.release()
+        return release(pUnk)
+      }
+
       internal static func queryInterface(_ pUnk: UnsafeMutablePointer<C_IInspectable>?, _ riid: UnsafePointer<SUPPORT_MODULE.IID>?, _ ppvObject: UnsafeMutablePointer<UnsafeMutableRawPointer?>?) -> HRESULT {
         guard let pUnk, let riid, let ppvObject else { return E_INVALIDARG }
         ppvObject.pointee = nil
@@ -134,11 +150,18 @@ public enum __ABI_ {
             return S_OK
         }
     )
+
+    internal static var ComposableVTable: C_IInspectableVtbl = {
+        var vtable = IInspectableVTable
+        vtable.AddRef = { AnyWrapper.addRefAggregated($0) }
+        vtable.Release = { AnyWrapper.releaseAggregated($0) }
+        return vtable
+    }()
 }
 
 extension ComposableImpl where CABI == C_IInspectable {
   public static func makeAbi() -> CABI {
-    let vtblPtr = withUnsafeMutablePointer(to: &__ABI_.IInspectableVTable) { $0 }
+    let vtblPtr = withUnsafeMutablePointer(to: &__ABI_.ComposableVTable) { $0 }
     return .init(lpVtbl: vtblPtr)
   }
 }
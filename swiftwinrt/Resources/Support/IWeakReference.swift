@@ -8,15 +8,100 @@ fileprivate extension IUnknownRef {
     }
 }
 
+/// A weak reference to a WinRT object, which resolves back to the object for as long as something else keeps it alive.
+///
+/// Objects implemented in Swift are held with a Swift weak reference, so resolving one gives back the object itself
+/// without going through the ABI or wrapping it again. Other objects are held through their IWeakReference, which is
+/// looked up once, along with the maker for the object's runtime class, so resolving one skips GetRuntimeClassName.
+public final class WeakReference<Target: AnyObject> {
+    private weak var swiftTarget: Target?
+    private let weakReference: __ABI_.IWeakReference?
+    private let maker: (any MakeFromAbi.Type)?
+    // projects the object when its maker is missing or doesn't make a Target, e.g. for an interface
+    private let project: ((SUPPORT_MODULE.IInspectable) -> Target?)?
+
+    public init(_ target: Target) throws {
+        guard let object = winrtObject(target) else {
+            self.swiftTarget = target
+            self.weakReference = nil
+            self.maker = nil
+            self.project = nil
+            return
+        }
+
+        let source: __ABI_.IWeakReferenceSource = try object.QueryInterface()
+        self.weakReference = try source.GetWeakReference()
+        // The runtime class of the object can't change, so look its maker up while we have the object
+        self.maker = SUPPORT_MODULE.maker(for: object)
+        self.project = projection(like: target)
+    }
+
+    /// The object, or nil if it has been destroyed
+    public func resolve() throws -> Target? {
+        guard let weakReference else { return swiftTarget }
+        guard let object = try weakReference.Resolve(IInspectable.IID) else { return nil }
+        if let made = maker?.from(abi: object) as? Target {
+            return made
+        }
+        return project?(object)
+    }
+}
+
+// Projects the objects a weak reference resolves to as the same kind of object as the one it was made from
+fileprivate func projection<Target: AnyObject>(like target: Target) -> (SUPPORT_MODULE.IInspectable) -> Target? {
+    if let implementation = target as? any AbiInterfaceImpl {
+        return interfaceProjection(like: implementation)
+    }
+    if Target.self is WinRTClass.Type {
+        return { make(type: Target.self, from: $0) }
+    }
+    return { $0 as? Target }
+}
+
+fileprivate func interfaceProjection<Target: AnyObject, Implementation: AbiInterfaceImpl>(
+    like _: Implementation
+) -> (SUPPORT_MODULE.IInspectable) -> Target? {
+    return { object in
+        guard let interface: Implementation.Bridge.SwiftABI = try? object.QueryInterface() else { return nil }
+        return Implementation.Bridge.from(abi: RawPointer(interface)) as? Target
+    }
+}
+
+// The WinRT object which a projected object wraps, or nil if the object is implemented in Swift
+func winrtObject(_ object: AnyObject) -> SUPPORT_MODULE.IInspectable? {
+    if let object = object as? WinRTClass {
+        // A Swift subclass aggregates its WinRT object, and is the identity of the two
+        return object.identity == nil ? object._inner : nil
+    }
+    return (object as? any AbiInterfaceImpl)?._default as? SUPPORT_MODULE.IInspectable
+}
+
+extension __ABI_ {
+    internal class IWeakReference: IUnknown {
+        override class var IID: SUPPORT_MODULE.IID { IID_IWeakReference }
+
+        func Resolve(_ iid: SUPPORT_MODULE.IID) throws -> SUPPORT_MODULE.IInspectable? {
+            var iid = iid
+            let (object) = try ComPtrs.initialize { (objectAbi: inout UnsafeMutablePointer<C_IInspectable>?) in
+                try perform(as: C_IWeakReference.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.Resolve(pThis, &iid, &objectAbi))
+                }
+            }
+            guard let object else { return nil }
+            return SUPPORT_MODULE.IInspectable(object)
+        }
+    }
+}
+
 func makeWeakReference(_ object: AnyObject, _ result: UnsafeMutablePointer<UnsafeMutableRawPointer?>) throws {
-    let wrapper = WeakReferenceWrapper(WeakReference(object))
+    let wrapper = WeakReferenceWrapper(WeakReferenceTarget(object))
     try wrapper.toABI {
         _ = $0.pointee.lpVtbl.pointee.AddRef($0)
         result.pointee = UnsafeMutableRawPointer($0)
     }
 }
 
-fileprivate class WeakReference {
+fileprivate class WeakReferenceTarget {
     public weak var target: AnyObject?
     public init(_ target: AnyObject) {
         self.target = target
@@ -24,7 +109,7 @@ fileprivate class WeakReference {
 }
 
 fileprivate class WeakReferenceWrapper: WinRTAbiBridgeWrapper<IWeakReferenceBridge> {
-    init(_ weakReference: WeakReference){
+    init(_ weakReference: WeakReferenceTarget){
         super.init(IWeakReferenceBridge.makeAbi(), weakReference)
     }
 
@@ -44,13 +129,13 @@ fileprivate class WeakReferenceWrapper: WinRTAbiBridgeWrapper<IWeakReferenceBrid
 
 fileprivate enum IWeakReferenceBridge: AbiBridge {
     typealias CABI = C_IWeakReference
-    typealias SwiftProjection = WeakReference
+    typealias SwiftProjection = WeakReferenceTarget
 
     static func makeAbi() -> C_IWeakReference {
         return C_IWeakReference(lpVtbl: &IWeakReferenceVTable)
     }
 
-    static func from(abi: consuming ComPtr<C_IWeakReference>?) -> WeakReference? {
+    static func from(abi: consuming ComPtr<C_IWeakReference>?) -> WeakReferenceTarget? {
         fatalError("Not needed")
     }
 }
@@ -8,6 +8,21 @@ fileprivate extension IUnknownRef {
     }
 }
 
+extension __ABI_ {
+    internal class IWeakReferenceSource: IUnknown {
+        override class var IID: SUPPORT_MODULE.IID { IID_IWeakReferenceSource }
+
+        func GetWeakReference() throws -> IWeakReference {
+            let (weakReference) = try ComPtrs.initialize { (weakReferenceAbi: inout UnsafeMutablePointer<C_IWeakReference>?) in
+                try perform(as: C_IWeakReferenceSource.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.GetWeakReference(pThis, &weakReferenceAbi))
+                }
+            }
+            return .init(weakReference!)
+        }
+    }
+}
+
 func makeWeakReferenceSource(_ object: AnyObject, _ result: UnsafeMutablePointer<UnsafeMutableRawPointer?>) throws {
     let wrapper = WeakReferenceSourceWrapper(object)
     try wrapper.toABI {
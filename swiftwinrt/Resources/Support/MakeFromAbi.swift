@@ -10,6 +10,45 @@ public protocol MakeFromAbi {
     static func from(abi: SUPPORT_MODULE.IInspectable) -> SwiftType
 }
 
+/// The makers of a module, keyed by runtime class name. swift-winrt generates one of these per module
+/// (`__MakerTable` in `<Module>+Makers.swift`), with the names laid out by a perfect hash so that a
+/// lookup is two hashes of the name and a single comparison.
+@_spi(WinRTInternal)
+public protocol MakerTable: AnyObject {
+    /// The seed to rehash a name with, indexed by the unseeded hash of the name
+    static var seeds: [UInt32] { get }
+    static var names: [String] { get }
+    static var makers: [any MakeFromAbi.Type] { get }
+}
+
+/// FNV-1a over the UTF-16 code units of a name, finished with the murmur3 mix. This has to match `utf16_hash` in swift-winrt,
+/// which lays out the generated tables.
+@inline(__always)
+func runtimeClassHash(_ name: UnsafeBufferPointer<WCHAR>, seed: UInt32) -> UInt32 {
+    var hash: UInt32 = 2166136261 ^ seed
+    for unit in name {
+        hash = (hash ^ UInt32(unit)) &* 16777619
+    }
+    hash ^= hash >> 16
+    hash = hash &* 0x85ebca6b
+    hash ^= hash >> 13
+    hash = hash &* 0xc2b2ae35
+    hash ^= hash >> 16
+    return hash
+}
+
+extension MakerTable {
+    static func maker(for name: UnsafeBufferPointer<WCHAR>) -> (any MakeFromAbi.Type)? {
+        let seeds = self.seeds
+        guard !seeds.isEmpty else { return nil }
+        let count = UInt32(seeds.count)
+        let seed = seeds[Int(runtimeClassHash(name, seed: 0) % count)]
+        let slot = Int(runtimeClassHash(name, seed: seed) % count)
+        guard names[slot].utf16.elementsEqual(name) else { return nil }
+        return makers[slot]
+    }
+}
+
 func make(typeName: SwiftTypeName, from abi: SUPPORT_MODULE.IInspectable) -> Any? {
     guard let makerType = NSClassFromString("\(typeName.module).\(typeName.typeName)Maker") as? any MakeFromAbi.Type else {
         return nil
@@ -83,7 +122,28 @@ private enum FactoryCacheEntry {
 private var factoryCache: [FactoryCacheKey: FactoryCacheEntry] = [:]
 private var factoryCacheLock = SRWLock()
 
+// The maker tables found so far, and the modules which have been looked for. Swift has no hook for
+// when a module is loaded, so a module's table is found by name the first time one of its classes
+// crosses the ABI, after which its classes never need NSClassFromString.
+private var makerTables: [any MakerTable.Type] = []
+private var makerTableModules: Set<String> = []
+
+private func registerMakerTable(for module: String) -> (any MakerTable.Type)? {
+    factoryCacheLock.withLock(.exclusive) {
+        guard makerTableModules.insert(module).inserted,
+              let table = NSClassFromString("\(module).__MakerTable") as? any MakerTable.Type else {
+            return nil
+        }
+        makerTables.append(table)
+        return table
+    }
+}
+
 func makeFrom(abi: SUPPORT_MODULE.IInspectable) -> Any? {
+    maker(for: abi)?.from(abi: abi)
+}
+
+func maker(for abi: SUPPORT_MODULE.IInspectable) -> (any MakeFromAbi.Type)? {
     // When creating a swift class which represents this type, we want to get the class name that we're trying to create
     // via GetRuntimeClassName so that we can create the proper derived type. For example, the API may return UIElement,
     // but we want to return a Button type.
@@ -96,13 +156,24 @@ func makeFrom(abi: SUPPORT_MODULE.IInspectable) -> Any? {
     guard let rawClassName else { return nil }
     defer { WindowsDeleteString(rawClassName) }
 
+    var length: UINT32 = 0
+    let name = UnsafeBufferPointer(start: WindowsGetStringRawBuffer(rawClassName, &length), count: Int(length))
+    let tables = factoryCacheLock.withLock(.shared) { makerTables }
+    for table in tables {
+        if let maker = table.maker(for: name) {
+            return maker
+        }
+    }
+
+    // Not in any table we know of yet, either because its module hasn't been seen before or because
+    // it has no maker. The cache below remembers the latter, and classes from modules without a table.
     let lookupKey = FactoryCacheKey(_unsafeBorrowing: rawClassName)
     let cached = factoryCacheLock.withLock(.shared) { factoryCache[lookupKey] }
 
     if let cached {
         switch cached {
         case .factory(let factory):
-            return factory.from(abi: abi)
+            return factory
         case .noFactory:
             return nil
         }
@@ -116,6 +187,9 @@ func makeFrom(abi: SUPPORT_MODULE.IInspectable) -> Any? {
 
     let factory: (any MakeFromAbi.Type)?
     if let typeName = IInspectable.GetSwiftTypeName(from: className) {
+        if let table = registerMakerTable(for: typeName.module), let maker = table.maker(for: name) {
+            return maker
+        }
         factory = NSClassFromString("\(typeName.module).\(typeName.typeName)Maker") as? any MakeFromAbi.Type
     } else {
         factory = nil
@@ -125,7 +199,7 @@ func makeFrom(abi: SUPPORT_MODULE.IInspectable) -> Any? {
     let entry: FactoryCacheEntry = factory.map { .factory($0) } ?? .noFactory
     factoryCacheLock.withLock(.exclusive) { factoryCache[storedKey] = entry }
 
-    return factory?.from(abi: abi)
+    return factory
 }
 
 func make<T:AnyObject>(type: T.Type, from abi: SUPPORT_MODULE.IInspectable) -> T? {
@@ -26,4 +26,11 @@ internal struct SRWLock: ~Copyable {
             return try body()
         }
     }
+
+    /// Runs the body with the lock held exclusively, unless another thread holds the lock.
+    mutating func withLockIfAvailable<Result>(_ body: () throws -> Result) rethrows -> Result? {
+        guard TryAcquireSRWLockExclusive(&lock) != 0 else { return nil }
+        defer { ReleaseSRWLockExclusive(&lock) }
+        return try body()
+    }
 }
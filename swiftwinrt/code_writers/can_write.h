@@ -63,6 +63,6 @@ namespace swiftwinrt
 
     static bool can_write(writer& w, typedef_base const& type)
     {
-        return w.filter.includes(type.type());
+        return w.filter.includes(type);
     }
 }
\ No newline at end of file
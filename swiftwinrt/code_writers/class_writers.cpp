@@ -18,6 +18,7 @@ namespace swiftwinrt
         auto typeName = type.swift_type_name();
         auto base_class = type.base_class;
         bool composable = type.is_composable();
+        bool eager = resolves_interfaces_eagerly(type);
         auto modifier = composable ? "open" : "public final";
 
         write_documentation_comment(w, type);
@@ -37,7 +38,6 @@ namespace swiftwinrt
             w.write("public final class %", typeName);
         }
 
-        auto interfaces = type.required_interfaces;
         separator s{ w };
         s();
 
@@ -99,14 +99,14 @@ namespace swiftwinrt
             {
                 auto generic_type = dynamic_cast<const generic_inst*>(default_interface);
                 guard = w.push_generic_params(*generic_type);
-                swiftAbi = w.write_temp("%.%", w.swift_module, bind_type_abi(generic_type));
+                swiftAbi = w.write_temp("%.%", w.generic_module(generic_type), bind_type_abi(generic_type));
             }
 
             auto modifier = composable ? "open" : "public";
 
             w.write(R"(private typealias SwiftABI = %
 private typealias CABI = %
-private lazy var _default: SwiftABI! = getInterfaceForCaching()
+%
 ^@_spi(WinRTInternal)
 override % func _getABI<T>() -> UnsafeMutablePointer<T>? {
     if T.self == CABI.self {
@@ -118,6 +118,7 @@ override % func _getABI<T>() -> UnsafeMutablePointer<T>? {
 )",
                 swiftAbi,
                 bind_type_mangled(default_interface),
+                eager ? "private var _default: SwiftABI { _interfaces._default }" : "private lazy var _default: SwiftABI! = getInterfaceForCaching()",
                 modifier);
             write_default_constructor_declarations(w, type, *default_interface);
 
@@ -138,13 +139,12 @@ override % func _getABI<T>() -> UnsafeMutablePointer<T>? {
                 }
                 else
                 {
-                    w.write("    switch iid {\n");
+                    std::vector<interface_info> interfaces;
                     for (auto& [_, info] : overridable_interfaces) {
-                        auto indent{ w.push_indent({2}) };
-                        w.write("%", bind<write_query_interface_case>(info));
+                        interfaces.push_back(info);
                     }
-                    w.write("        default: return %\n", base_case);
-                    w.write("    }\n");
+                    auto indent{ w.push_indent({1}) };
+                    write_query_interface_switch(w, interfaces, base_case);
                 }
                 w.write("}\n");
             }
@@ -169,6 +169,7 @@ override % func _getABI<T>() -> UnsafeMutablePointer<T>? {
 
         bool has_collection_conformance = false;
         std::vector<std::string> interfaces_to_release;
+        std::vector<std::pair<std::string, std::string>> interfaces_to_resolve;
         for (const auto& [interface_name, info] : type.required_interfaces)
         {
             if (interface_name.empty() || !can_write(w, info.type)) { continue; }
@@ -189,12 +190,48 @@ override % func _getABI<T>() -> UnsafeMutablePointer<T>? {
                 {
                     continue;
                 }
-                interfaces_to_release.push_back(get_swift_name(info));
+                if (!resolves_interface_eagerly(type, info))
+                {
+                    interfaces_to_release.push_back(get_swift_name(info));
+                }
+                else if (!info.is_default)
+                {
+                    interfaces_to_resolve.emplace_back(get_swift_name(info), get_cached_interface_abi(w, info));
+                }
                 write_interface_impl_members(w, info, /* type_definition: */ type);
             }
         }
 
-        if (default_interface)
+        if (eager)
+        {
+            w.write("private struct _Interfaces {\n");
+            {
+                auto indent = w.push_indent();
+                w.write("let _default: SwiftABI\n");
+                for (const auto& [name, abi] : interfaces_to_resolve)
+                {
+                    w.write("let %: %\n", name, abi);
+                }
+                w.write("init(_ abi: %.IInspectable) {\n", w.support);
+                w.write("    _default = abi as? SwiftABI ?? (try! abi.QueryInterface())\n");
+                for (const auto& [name, abi] : interfaces_to_resolve)
+                {
+                    w.write("    % = try! abi.QueryInterface()\n", name);
+                }
+                w.write("}\n");
+            }
+            w.write("}\n");
+            w.write("private let _interfaces: _Interfaces\n");
+
+            // The bridge already holds the default interface, so wrapping it doesn't need to query for it again
+            w.write("fileprivate static func _wrap(_ abi: consuming ComPtr<%>) -> % {\n",
+                bind_type_mangled(default_interface),
+                typeName);
+            w.write("    .init(fromAbi: SwiftABI(abi))\n");
+            w.write("}\n");
+        }
+
+        if (default_interface && (!eager || !interfaces_to_release.empty()))
         {
             w.write("deinit {\n");
             for (const auto& iface : interfaces_to_release)
@@ -229,6 +266,10 @@ override % func _getABI<T>() -> UnsafeMutablePointer<T>? {
                     {
                         w.write("return UnsealedWinRTClassWrapper<Composable>.unwrapFrom(base: abi)\n");
                     }
+                    else if (resolves_interfaces_eagerly(type))
+                    {
+                        w.write("return %._wrap(abi)\n", type);
+                    }
                     else
                     {
                         w.write("return .init(fromAbi: %.IInspectable(abi))\n", w.support);
@@ -281,7 +322,7 @@ override % func _getABI<T>() -> UnsafeMutablePointer<T>? {
         }
 
         std::vector<named_interface_info> other_composable_interfaces;
-        auto interfaces = type.required_interfaces;
+        auto& interfaces = type.required_interfaces;
         for (auto iter = interfaces.rbegin(); iter != interfaces.rend(); iter++)
         {
             const auto& [interface_name, info] = *iter;
@@ -332,7 +373,7 @@ override % func _getABI<T>() -> UnsafeMutablePointer<T>? {
 
         {
             auto indent = w.push_indent();
-            write_iunknown_methods(w, *overrides.type);
+            write_iunknown_methods(w, *overrides.type, /* aggregated */ true);
             write_iinspectable_methods(w, overrides.type, other_interfaces, true);
 
             separator s{ w, ",\n\n" };
@@ -357,14 +398,21 @@ override % func _getABI<T>() -> UnsafeMutablePointer<T>? {
 )");
     }
 
+    // With -factory-cache the factories are resolved through the support module's process wide ActivationFactoryCache,
+    // which can be prewarmed and can share agile factories between a class's interfaces
+    static std::string_view activation_factory_getter()
+    {
+        return settings.factory_cache ? "ActivationFactoryCache.factory" : "RoGetActivationFactory";
+    }
+
     void write_factory_constructors(writer& w, attributed_type const& factory, class_type const& type, metadata_type const& default_interface)
     {
         if (auto factoryIface = dynamic_cast<const interface_type*>(factory.type))
         {
             interface_info factory_info{ factoryIface };
             auto swift_name = get_swift_name(factory_info);
-            w.write("private static let %: %.% = try! RoGetActivationFactory(\"%\")\n",
-                swift_name, abi_namespace(factoryIface), factory.type, get_full_type_name(type));
+            w.write("private static let %: %.% = try! %(\"%\")\n",
+                swift_name, abi_namespace(factoryIface), factory.type, activation_factory_getter(), get_full_type_name(type));
             for (const auto& method : factoryIface->functions)
             {
                 if (!can_write(w, method)) continue;
@@ -384,20 +432,12 @@ override % func _getABI<T>() -> UnsafeMutablePointer<T>? {
         {
             auto base_class = type.base_class;
 
-            w.write("private static let _defaultFactory: %.IActivationFactory = try! RoGetActivationFactory(\"%\")\n",
-                w.support, get_full_type_name(type));
+            w.write("private static let _defaultFactory: %.IActivationFactory = try! %(\"%\")\n",
+                w.support, activation_factory_getter(), get_full_type_name(type));
             w.write("%public init() {\n", has_default_constructor(base_class) ? "override " : "");
             {
                 auto indent = w.push_indent();
-                auto activateInstance = "try! Self._defaultFactory.ActivateInstance()";
-                if (base_class)
-                {
-                    w.write("super.init(fromAbi: %)\n", activateInstance);
-                }
-                else
-                {
-                    w.write("super.init(%)\n", activateInstance);
-                }
+                write_class_super_init(w, type, "try! Self._defaultFactory.ActivateInstance()");
             }
             w.write("}\n\n");
         }
@@ -437,10 +477,11 @@ public init<Composable: ComposableImpl>(
     {
         if (auto factoryIface = dynamic_cast<const interface_type*>(factory.type))
         {
-            w.write("private static var _% : %.% =  try! RoGetActivationFactory(\"%\")\n\n",
+            w.write("private static var _% : %.% =  try! %(\"%\")\n\n",
                     factory.type,
                     abi_namespace(factoryIface),
                     factory.type,
+                    activation_factory_getter(),
                     get_full_type_name(type));
 
             interface_info factory_info{ factoryIface };
@@ -489,14 +530,7 @@ public init<Composable: ComposableImpl>(
             w.support);
         {
             auto indent = w.push_indent();
-            if (base_class)
-            {
-                w.write("super.init(fromAbi: fromAbi)\n");
-            }
-            else
-            {
-                w.write("super.init(fromAbi)\n");
-            }
+            write_class_super_init(w, type, "fromAbi");
         }
         w.write("}\n\n");
 
@@ -528,10 +562,11 @@ public init<Composable: ComposableImpl>(
             static_info.attributed = true;
 
             auto impl_name = get_swift_name(static_info);
-            w.write("private static let %: %.% = try! RoGetActivationFactory(\"%\")\n",
+            w.write("private static let %: %.% = try! %(\"%\")\n",
                 impl_name,
                 abi_namespace(statics.type),
                 statics.type->swift_type_name(),
+                activation_factory_getter(),
                 get_full_type_name(type));
 
             for (const auto& method : ifaceType->functions)
@@ -616,7 +651,7 @@ public init<Composable: ComposableImpl>(
             bind([&](writer& w) {
                 if (is_generic_inst(overrides))
                 {
-                    w.write("%.%", w.swift_module, composableName);
+                    w.write("%.%", w.generic_module(overrides), composableName);
                 }
                 else
                 {
@@ -38,6 +38,17 @@ namespace swiftwinrt
         };
     }
 
+    // Shared generic instantiations are used from other modules than their owner, so have to be public
+    inline bool is_shared_generic(metadata_type const& type)
+    {
+        return settings.generic_owners.contains(type.swift_full_name());
+    }
+
+    inline std::string_view generic_access_level(metadata_type const& type)
+    {
+        return is_shared_generic(type) ? "public" : "internal";
+    }
+
     template<typename T>
     inline void write_generic_impl_name_base(writer& w, T const& type)
     {
@@ -50,7 +61,7 @@ namespace swiftwinrt
         else
         {
             // generics are written once per module and aren't namespaced
-            w.write("%.%", w.swift_module, implName);
+            w.write("%.%", w.generic_module(type), implName);
         }
     }
 
@@ -180,7 +191,7 @@ namespace swiftwinrt
             if (w.full_type_names)
             {
                 // generics are written once per module and aren't namespaced
-                w.write("%.%", w.swift_module, handlerWrapperTypeName);
+                w.write("%.%", w.generic_module(type), handlerWrapperTypeName);
             }
             else
             {
@@ -378,18 +389,65 @@ namespace swiftwinrt
         }
     }
 
-    static void write_query_interface_case(writer& w, interface_info const& iface)
+    // The first 32 bits of an interface's IID, which are known up front for every interface we write
+    static uint32_t get_iid_data1(metadata_type const& type)
+    {
+        if (auto inst = dynamic_cast<const generic_inst*>(&type))
+        {
+            auto& iidHash = inst->iid_hash();
+            return (uint32_t{ iidHash[0] } << 24) | (uint32_t{ iidHash[1] } << 16) | (uint32_t{ iidHash[2] } << 8) | iidHash[3];
+        }
+
+        auto& typedef_type = dynamic_cast<typedef_base const&>(type);
+        auto attribute = get_attribute(typedef_type.type(), "Windows.Foundation.Metadata", "GuidAttribute");
+        if (!attribute)
+        {
+            throw_invalid("'Windows.Foundation.Metadata.GuidAttribute' attribute for type '", type.swift_full_name(), "' not found");
+        }
+        return std::get<uint32_t>(std::get<ElemSig>(attribute.Value().FixedArgs()[0].value).value);
+    }
+
+    // Switches on Data1 of the IID, which the compiler lowers to a jump table or a binary search over constants
+    // rather than a chain of GUID comparisons, and then compares the whole IID of the interface it picks out.
+    // Interfaces which share Data1 are compared in turn within the same case.
+    static void write_query_interface_switch(writer& w, std::vector<interface_info> const& interfaces, std::string_view const& fallback)
     {
-        w.write("case %.IID:\n", bind_wrapper_fullname(iface.type));
-        w.write("    let wrapper = %(self)\n", bind_wrapper_fullname(iface.type));
-        w.write("    return wrapper!.queryInterface(iid)\n");
+        std::map<uint32_t, std::vector<metadata_type const*>> cases;
+        for (auto& iface : interfaces)
+        {
+            auto& types = cases[get_iid_data1(*iface.type)];
+            if (std::find(types.begin(), types.end(), iface.type) == types.end())
+            {
+                types.push_back(iface.type);
+            }
+        }
+
+        w.write("switch iid.Data1 {\n");
+        for (auto& [data1, types] : cases)
+        {
+            w.write_printf("    case 0x%08X:\n", data1);
+            for (auto type : types)
+            {
+                w.write(R"(        if iid == %.IID {
+            let wrapper = %(self)
+            return wrapper!.queryInterface(iid)
+        }
+)", bind_wrapper_fullname(type), bind_wrapper_fullname(type));
+            }
+        }
+        w.write("    default: break\n");
+        w.write("}\n");
+        w.write("return %\n", fallback);
     }
 
-    static void write_iunknown_methods(writer& w, metadata_type const& type)
+    // The wrappers of overrides interfaces also have to keep the aggregating Swift object alive, everything else
+    // only counts references on the wrapper itself
+    static void write_iunknown_methods(writer& w, metadata_type const& type, bool aggregated = false)
     {
         auto wrapper_name = w.write_temp("%", bind_wrapper_name(type));
+        auto suffix = aggregated ? "Aggregated" : "";
         w.write("QueryInterface: { %.queryInterface($0, $1, $2) },\n", wrapper_name);
-        w.write("AddRef: { %.addRef($0) },\n", wrapper_name);
-        w.write("Release: { %.release($0) },\n", wrapper_name);
+        w.write("AddRef: { %.addRef%($0) },\n", wrapper_name, suffix);
+        w.write("Release: { %.release%($0) },\n", wrapper_name, suffix);
     }
 }
@@ -12,7 +12,7 @@ namespace swiftwinrt
         // The bridge classes have a typealias for the parameters, and we use those
         // parameters for the delegate signature to create the bridge. The swift compiler
         // complains if the typealias isn't placed in a tuple
-        function_def delegate_method = type.functions[0];
+        auto& delegate_method = type.functions[0];
         w.write("public typealias % = (%) throws -> %\n",
             type,
             bind<write_comma_param_types>(delegate_method.params),
@@ -23,7 +23,7 @@ namespace swiftwinrt
     {
         if (can_write(w, type) && !type.is_generic())
         {
-            auto delegate_method = type.functions[0];
+            auto& delegate_method = type.functions[0];
             write_delegate_implementation_body(w, type, delegate_method);
         }
     }
@@ -64,7 +64,7 @@ namespace swiftwinrt
         auto data = w.write_temp("%", bind<write_comma_param_types>(invoke_method.params));
         auto return_type = w.write_temp("%", bind<write_delegate_return_type>(invoke_method));
         const bool is_generic = is_generic_inst(type);
-        auto access_level = is_generic ? "internal" : "public";
+        std::string_view access_level = is_generic ? generic_access_level(type) : "public";
         auto handlerType = w.write_temp("%", bind<write_swift_type_identifier>(type));
         auto abi_guard = w.push_abi_types(is_generic);
         w.write(format,
@@ -100,7 +100,7 @@ namespace swiftwinrt
     }
 }
 
-)", is_generic ? "internal" : "public",
+)", is_generic ? generic_access_level(inst) : "public",
     delegate_abi_name,
     is_generic ? w.swift_module : abi_namespace(w.type_namespace),
     is_generic ? delegate_abi_name : w.write_temp("%", inst));
@@ -111,9 +111,9 @@ namespace swiftwinrt
         auto impl_name = w.write_temp("%", bind_bridge_fullname(type));
         auto wrapper_name = w.write_temp("%", bind_wrapper_name(type));
         auto format = R"(
-typealias % = InterfaceWrapperBase<%>
+%typealias % = InterfaceWrapperBase<%>
 )";
-        w.write(format, wrapper_name, impl_name);
+        w.write(format, is_shared_generic(type) ? "public " : "", wrapper_name, impl_name);
     }
 
     void write_vtable(writer& w, delegate_type const& type)
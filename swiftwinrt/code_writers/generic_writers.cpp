@@ -11,19 +11,7 @@ namespace swiftwinrt
     {
         auto abi_guard = w.push_mangled_names(true);
 
-        static constexpr std::uint8_t namespaceGuidBytes[] =
-        {
-            0x11, 0xf4, 0x7a, 0xd5,
-            0x7b, 0x73,
-            0x42, 0xc0,
-            0xab, 0xae, 0x87, 0x8b, 0x1e, 0x16, 0xad, 0xee
-        };
-        sha1 signatureHash;
-        signatureHash.append(namespaceGuidBytes, std::size(namespaceGuidBytes));
-        type.append_signature(signatureHash);
-        auto iidHash = signatureHash.finalize();
-        iidHash[6] = (iidHash[6] & 0x0F) | 0x50;
-        iidHash[8] = (iidHash[8] & 0x3F) | 0x80;
+        auto& iidHash = type.iid_hash();
         auto format = R"(private var IID_%: %.IID {
     .init(%)// %
 }
@@ -67,15 +55,18 @@ namespace swiftwinrt
 )
 )");
 
+        auto modifier = is_shared_generic(type) ? "public " : "";
         if (is_winrt_ireference(type))
         {
-            w.write("typealias % = ReferenceWrapperBase<%>\n",
+            w.write("%typealias % = ReferenceWrapperBase<%>\n",
+                modifier,
                 bind_wrapper_name(type),
                 bind_bridge_fullname(type));
         }
         else
         {
-            w.write("typealias % = InterfaceWrapperBase<%>\n",
+            w.write("%typealias % = InterfaceWrapperBase<%>\n",
+                modifier,
                 bind_wrapper_name(type),
                 bind_bridge_fullname(type));
         }
@@ -100,31 +91,38 @@ namespace swiftwinrt
 
         auto impl_names = w.push_impl_names(true);
 
-        w.write(R"(internal enum %: ReferenceBridge {
-    typealias CABI = %
-    typealias SwiftProjection = %
-    static var IID: %.IID { IID_% }
+        auto modifier = is_shared_generic(type) ? "public " : "";
+        w.write(R"(% enum %: ReferenceBridge {
+    %typealias CABI = %
+    %typealias SwiftProjection = %
+    %static var IID: %.IID { IID_% }
 
-    static func from(abi: consuming ComPtr<CABI>?) -> SwiftProjection? {
+    %static func from(abi: consuming ComPtr<CABI>?) -> SwiftProjection? {
         guard let val = abi else { return nil }
         var result: %%
         try! CHECKED(val.get().pointee.lpVtbl.pointee.get_Value(val.get(), &result))
         return %
     }
 
-    static func makeAbi() -> CABI {
+    %static func makeAbi() -> CABI {
         let vtblPtr = withUnsafeMutablePointer(to: &%VTable) { $0 }
         return .init(lpVtbl: vtblPtr)
     }
 }
-)", bind_bridge_name(type),
+)", generic_access_level(type),
+    bind_bridge_name(type),
+    modifier,
     type.mangled_name(),
+    modifier,
     get_full_swift_type_name(w, generic_param),
+    modifier,
     w.support,
     type.mangled_name(),
+    modifier,
     bind<write_type>(*generic_param, write_type_params::c_abi),
     bind<write_default_init_assignment>(*generic_param, projection_layer::c_abi),
     bind<write_consume_type>(generic_param, "result", true),
+    modifier,
     type.mangled_name());
     }
 
@@ -203,7 +201,7 @@ namespace swiftwinrt
         auto generics_guard = w.push_generic_params(type);
         if (is_delegate(type))
         {
-            auto delegate_method = type.functions[0];
+            auto& delegate_method = type.functions[0];
             write_delegate_implementation_body(w, type, delegate_method);
         }
         else if (!is_winrt_ireference(type))
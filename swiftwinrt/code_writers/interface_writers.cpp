@@ -1,6 +1,7 @@
 #include "writer_helpers.h"
 #include "interface_writers.h"
 #include "utility/swift_codegen_utils.h"
+#include "utility/profiling.h"
 
 namespace swiftwinrt
 {
@@ -90,7 +91,7 @@ public class %Maker: MakeFromAbi {
             vtable = swiftABI;
         }
 
-        auto modifier = is_generic ? "internal" : "public";
+        std::string_view modifier = is_generic ? generic_access_level(type) : "public";
         w.write(R"(% enum % : AbiInterfaceBridge {
     % typealias CABI = %
     % typealias SwiftABI = %
@@ -218,7 +219,7 @@ public class %Maker: MakeFromAbi {
         }
 
         auto typeName = swiftwinrt::remove_backtick(type.swift_type_name());
-        auto interfaces = type.required_interfaces;
+        auto& interfaces = type.required_interfaces;
         separator s{ w };
         auto implements = w.write_temp("%", bind_each([&](writer& w, std::pair<std::string, interface_info> const& iface) {
             s();
@@ -321,21 +322,18 @@ public class %Maker: MakeFromAbi {
             // have to write the queryInterface implementation themselves.
             w.write("extension % {\n", typeName);
             w.write("    public func queryInterface(_ iid: %.IID) -> IUnknownRef? {\n", w.support);
-            w.write("        switch iid {\n");
-            auto indent{ w.push_indent({3}) };
+            auto indent{ w.push_indent({2}) };
 
-            w.write("%", bind<write_query_interface_case>(interface_info{ &type }));
-
-            for (auto [name, info] : type.required_interfaces) {
+            std::vector<interface_info> interfaces{ interface_info{ &type } };
+            for (auto& [name, info] : type.required_interfaces) {
                 if (can_write(w, info.type))
                 {
-                    w.write("%", bind<write_query_interface_case>(info));
+                    interfaces.push_back(info);
                 }
             }
+            write_query_interface_switch(w, interfaces, "nil");
 
-            w.write("default: return nil\n");
             indent.end();
-            w.write("        }\n");
             w.write("    }\n");
             w.write("}\n");
 
@@ -365,30 +363,68 @@ public class %Maker: MakeFromAbi {
 
         if (is_winrt_async_result_type(type))
         {
+            auto name = type.swift_type_name();
             std::string return_clause;
-            const metadata_type* result_type = nullptr;
-            if (type.generic_params.size() > 0) {
+            if (name.starts_with("IAsyncOperation")) {
                 return_clause = w.write_temp(" -> %", type.generic_params[0]);
             }
             w.write(R"(public extension % {
     func get() async throws% {
         if status == .started {
-            let event = WaitableEvent()
-            completed = { _, _ in
-                Task { await event.signal() }
-            }
-            await event.wait()
+            try await waitForCompletion { resume in completed = { _, _ in resume() } }
         }
         return try getResults()
     }
-}
-
 )", bind<write_swift_type_identifier>(type), return_clause);
+
+            // the progress type is the last generic parameter of IAsyncActionWithProgress and IAsyncOperationWithProgress
+            if (name.find("WithProgress") != std::string_view::npos)
+            {
+                w.write(R"(
+    /// The progress reported by the operation, ending once it completes. This can be iterated alongside `get()`,
+    /// and more than once. Cancelling the iterating task cancels the operation, breaking out of the loop doesn't.
+    func progressUpdates() -> AsyncProgressUpdates<%> {
+        makeProgressUpdates(
+            setProgress: { report in progress = { _, value in report(value) } },
+            setCompleted: { complete in completed = { _, _ in complete() } })
+    }
+)", type.generic_params.back());
+            }
+            w.write("}\n\n");
         }
     }
 
+    // With -inlinable-abi, thunks are written as @inlinable so that calls from other modules go straight to the
+    // vtable. Everything an inlinable body references has to be public though, and the wrappers of delegates and
+    // of generic instantiations are internal to the module which writes them, so those thunks stay opaque.
+    static bool can_inline_abi_function(typedef_base const& type, function_def const& function)
+    {
+        if (!settings.inlinable_abi || type.is_generic())
+        {
+            return false;
+        }
+
+        auto is_internal = [](metadata_type const* param_type)
+        {
+            return is_generic_inst(param_type) || is_delegate(param_type);
+        };
+
+        if (function.return_type && is_internal(function.return_type->type))
+        {
+            return false;
+        }
+
+        return std::none_of(function.params.begin(), function.params.end(), [&](function_param const& param)
+        {
+            return is_internal(param.type);
+        });
+    }
+
     void write_interface_abi_body(writer& w, typedef_base const& type, std::vector<function_def> const& methods)
     {
+        static profile_counter inlined{ "inlinable abi thunks" };
+        static profile_counter opaque{ "inlinable abi thunks left opaque" };
+
         auto factory_info = try_get_factory_info(w, type);
         auto classType = try_get_exclusive_to(w, type);
 
@@ -420,11 +456,22 @@ public class %Maker: MakeFromAbi {
                 auto func_name = get_abi_name(function);
                 auto full_names = w.push_full_type_names(true);
 
+                auto inlinable = can_inline_abi_function(type, function);
+                if (settings.inlinable_abi)
+                {
+                    (inlinable ? inlined : opaque).add();
+                }
+
                 auto returnStatement = isInitializer ?
                     w.write_temp(" -> %", bind_type_abi(classType->default_interface)) :
                     w.write_temp("%", bind<write_return_type_declaration>(function, write_type_params::swift));
 
-                std::vector<function_param> params = composableFactory ? get_projected_params(factory_info.value(), function) : function.params;
+                std::vector<function_param> projected_params;
+                if (composableFactory)
+                {
+                    projected_params = get_projected_params(factory_info.value(), function);
+                }
+                auto const& params = composableFactory ? projected_params : function.params;
                 std::string written_params = w.write_temp("%", bind<write_function_params2>(params, write_type_params::swift));
                 if (composableFactory)
                 {
@@ -432,7 +479,8 @@ public class %Maker: MakeFromAbi {
                     written_params.append(w.write_temp("_ baseInterface: UnsealedWinRTClassWrapper<%.Composable>?, _ innerInterface: inout %.IInspectable?", bind_bridge_name(*classType), w.support));
                 }
 
-                w.write("% func %(%) throws% {\n",
+                w.write("%% func %(%) throws% {\n",
+                    inlinable ? "@inlinable " : "",
                     is_exclusive(type) ? "public" : "open",
                     func_name,
                     written_params,
@@ -485,6 +533,34 @@ bind<write_abi_args>(function));
                     }
                 }
                 w.write("}\n\n");
+
+                // Events wrap their handlers themselves (see Event.init(bridge:)) and add them through an
+                // overload which takes the delegate's ABI pointer as is
+                if (function.def.SpecialName() && func_name.starts_with("add_"))
+                {
+                    auto const& handler = function.params[0];
+                    auto token_name = function.return_type->name;
+                    w.write(R"(^@_spi(WinRTInternal)
+%public func %(_ %: %) throws -> EventRegistrationToken {
+    var %: EventRegistrationToken = .init()
+    _ = try perform(as: %.self) { pThis in
+        try CHECKED(pThis.pointee.lpVtbl.pointee.%(pThis, %, &%))
+    }
+    return %
+}
+
+)",
+                        settings.inlinable_abi && !type.is_generic() ? "@inlinable " : "",
+                        func_name,
+                        get_swift_name(handler),
+                        bind<write_type>(*handler.type, write_type_params::c_abi),
+                        token_name,
+                        bind_type_mangled(type),
+                        func_name,
+                        get_swift_name(handler),
+                        token_name,
+                        token_name);
+                }
             }
             catch (std::exception const& e)
             {
@@ -636,12 +712,13 @@ bind_bridge_fullname(type));
         auto event = def.def;
         auto format = R"(%var % : Event<%> = {
   .init(
+    bridge: %.self,
     add: { [weak self] in
       guard let this = self?.% else { return .init() }
-      return try! this.add_%($0)
+      return try this.add_%($0)
     },
     remove: { [weak self] in
-     try? self?.%.remove_%($0)
+     try self?.%.remove_%($0)
    }
   )
 }()
@@ -650,8 +727,9 @@ bind_bridge_fullname(type));
 
         auto static_format = R"(%var % : Event<%> = {
   .init(
-    add: { try! %.add_%($0) },
-    remove: { try? %.remove_%($0) }
+    bridge: %.self,
+    add: { try %.add_%($0) },
+    remove: { try %.remove_%($0) }
   )
 }()
 
@@ -675,15 +753,43 @@ bind_bridge_fullname(type));
             modifier.append("lazy ");
         }
         assert(delegate_method.def);
-        w.write(iface.attributed ? static_format : format,
-            modifier, // % var
-            get_swift_name(event), // var %
-            def.type, // Event<%>
-            get_swift_name(iface), // weak this = %
-            def.def.Name(), // add_&Impl
-            get_swift_name(iface), // weak this = %
-            def.def.Name() // remove_&Impl
-        );
+        if (iface.attributed)
+        {
+            w.write(static_format,
+                modifier, // % var
+                get_swift_name(event), // var %
+                def.type, // Event<%>
+                bind_bridge_fullname(*def.type), // bridge: %.self
+                get_swift_name(iface), // %.add_
+                def.def.Name(), // add_&Impl
+                get_swift_name(iface), // %.remove_
+                def.def.Name() // remove_&Impl
+            );
+        }
+        else
+        {
+            w.write(format,
+                modifier, // % var
+                get_swift_name(event), // var %
+                def.type, // Event<%>
+                bind_bridge_fullname(*def.type), // bridge: %.self
+                get_swift_name(iface), // weak this = %
+                def.def.Name(), // add_&Impl
+                get_swift_name(iface), // weak this = %
+                def.def.Name() // remove_&Impl
+            );
+        }
+    }
+
+    // The Swift ABI type which a class or wrapper caches the interface as
+    std::string get_cached_interface_abi(writer& w, interface_info const& info)
+    {
+        if (is_generic_inst(info.type))
+        {
+            auto guard{ w.push_generic_params(info) };
+            return w.write_temp("%", bind_type_abi(info.type));
+        }
+        return w.write_temp("%.%", abi_namespace(info.type->swift_logical_namespace()), info.type->swift_type_name());
     }
 
     void write_interface_impl_members(writer& w, interface_info const& info, typedef_base const& type_definition)
@@ -693,15 +799,20 @@ bind_bridge_fullname(type));
 
         if (!info.is_default || (!is_class && info.base))
         {
-            auto swiftAbi = w.write_temp("%.%", abi_namespace(info.type->swift_logical_namespace()), info.type->swift_type_name());
-            if (is_generic_inst(info.type))
+            auto class_definition = dynamic_cast<const class_type*>(&type_definition);
+            if (class_definition && resolves_interface_eagerly(*class_definition, info))
+            {
+                w.write("private var %: % { _interfaces.% }\n",
+                    get_swift_name(info),
+                    get_cached_interface_abi(w, info),
+                    get_swift_name(info));
+            }
+            else
             {
-                auto guard{ w.push_generic_params(info) };
-                swiftAbi = w.write_temp("%", bind_type_abi(info.type));
+                w.write("private lazy var %: %! = getInterfaceForCaching()\n",
+                    get_swift_name(info),
+                    get_cached_interface_abi(w, info));
             }
-            w.write("private lazy var %: %! = getInterfaceForCaching()\n",
-                get_swift_name(info),
-                swiftAbi);
         }
 
         if (auto iface = dynamic_cast<const interface_type*>(info.type))
@@ -15,6 +15,7 @@ namespace swiftwinrt
     void write_interface_abi_body(writer& w, typedef_base const& type, std::vector<function_def> const& methods);
     void write_vtable(writer& w, interface_type const& type);
     void write_implementable_interface(writer& w, interface_type const& type);
+    std::string get_cached_interface_abi(writer& w, interface_info const& info);
     void write_interface_impl_members(writer& w, interface_info const& info, typedef_base const& type_definition);
 
     void write_class_impl_func(writer& w, function_def const& method, interface_info const& iface, typedef_base const& type_definition);
@@ -6,9 +6,22 @@
 #include "can_write.h"
 #include "struct_writers.h"
 #include "utility/separator.h"
+#include "utility/profiling.h"
 
 namespace swiftwinrt
 {
+    // Blittable structs only hold fundamentals, enums and other blittable structs, so with -inlinable-abi their
+    // layout is frozen and the conversions to and from the ABI are inlinable into other modules
+    static bool is_struct_inlinable(struct_type const& type)
+    {
+        return settings.inlinable_abi && is_struct_blittable(type);
+    }
+
+    static std::string_view inlinable_attribute(struct_type const& type)
+    {
+        return is_struct_inlinable(type) ? "@inlinable " : "";
+    }
+
     void write_struct_initializer_params(writer & w, struct_type const& type)
     {
         separator s{ w };
@@ -31,12 +44,17 @@ namespace swiftwinrt
         bool is_blittable = is_struct_blittable(type);
         if (is_blittable)
         {
-            w.write(R"(extension % {
-    public static func from(swift: %) -> % {
-        .init(%)
+            // the inlinable conversion refers to hasAbiLayout, which inlinable code can only do from SPI
+            auto swift_type = get_full_swift_type_name(w, type);
+            w.write(R"(%extension % {
+    %public static func from(swift: %) -> % {
+        guard %.hasAbiLayout else {
+            return .init(%)
+        }
+        return swift.copyToABI()
     }
 }
-)", bind_type_mangled(type), get_full_swift_type_name(w, type), bind_type_mangled(type), bind([&](writer& w) {
+)", is_struct_inlinable(type) ? "@_spi(WinRTInternal)\n" : "", bind_type_mangled(type), inlinable_attribute(type), swift_type, bind_type_mangled(type), swift_type, bind([&](writer& w) {
                     separator s{ w };
             for (auto&& field : type.members)
             {
@@ -63,7 +81,14 @@ namespace swiftwinrt
 
     void write_struct(writer& w, struct_type const& type)
     {
+        static profile_counter frozen{ "inlinable abi structs" };
+
         write_documentation_comment(w, type);
+        if (is_struct_inlinable(type))
+        {
+            frozen.add();
+            w.write("@frozen\n");
+        }
         w.write("public struct %: Hashable, Codable, Sendable {\n", type);
         {
             auto indent_guard1 = w.push_indent();
@@ -108,10 +133,19 @@ namespace swiftwinrt
         {
             auto indent_guard1 = w.push_indent();
             w.write("public typealias ABI = %\n", bind_type_mangled(type));
-            w.write("public static func from(abi: ABI) -> Self {\n");
+            w.write("%public static func from(abi: ABI) -> Self {\n", inlinable_attribute(type));
             {
                 auto from_body_indent = w.push_indent();
 
+                // a blittable struct with the same layout as its ABI is copied as a whole
+                std::optional<writer::indent_guard> layout_guard;
+                if (is_struct_blittable(type))
+                {
+                    w.write("guard hasAbiLayout else {\n");
+                    layout_guard.emplace(w.push_indent());
+                    w.write("return ");
+                }
+
                 w.write(".init(");
                 separator s{ w };
                 for (auto&& field : type.members)
@@ -127,10 +161,17 @@ namespace swiftwinrt
                     }
                 }
                 w.write(")\n");
+
+                if (layout_guard)
+                {
+                    layout_guard.reset();
+                    w.write("}\n");
+                    w.write("return copy(fromABI: abi)\n");
+                }
             }
             w.write("}\n");
 
-            w.write("public func toABI() -> ABI {\n");
+            w.write("%public func toABI() -> ABI {\n", inlinable_attribute(type));
             {
                 auto from_body_indent = w.push_indent();
                 if (is_struct_blittable(type))
@@ -145,6 +186,41 @@ namespace swiftwinrt
             w.write("}\n");
         }
         w.write("}\n\n");
+
+        if (is_struct_blittable(type))
+        {
+            write_struct_blittable_conformance(w, type);
+        }
+    }
+
+    // Blittable structs are usually laid out the same in Swift as in C, but Swift doesn't pad a struct out to
+    // its alignment when it is nested in another, so the layouts are compared rather than assumed to match.
+    void write_struct_blittable_conformance(writer& w, struct_type const& type)
+    {
+        w.write("@_spi(WinRTInternal)\n");
+        w.write("extension %: WinRTBlittableStruct {\n", type);
+        {
+            auto indent_guard1 = w.push_indent();
+            w.write("%public static var hasAbiLayout: Bool {\n", inlinable_attribute(type));
+            {
+                auto indent_guard2 = w.push_indent();
+                w.write("MemoryLayout<Self>.stride == MemoryLayout<ABI>.stride");
+                auto indent_guard3 = w.push_indent();
+                for (auto&& field : type.members)
+                {
+                    w.write(" &&\nMemoryLayout<Self>.offset(of: \\.%) == MemoryLayout<ABI>.offset(of: \\.%)",
+                        get_swift_name(field),
+                        get_abi_name(field));
+                    if (dynamic_cast<const struct_type*>(field.type))
+                    {
+                        w.write(" &&\n%.hasAbiLayout", bind<write_type>(*field.type, write_type_params::swift));
+                    }
+                }
+                w.write("\n");
+            }
+            w.write("}\n");
+        }
+        w.write("}\n\n");
     }
 
     void write_struct_abi(writer& w, struct_type const& type)
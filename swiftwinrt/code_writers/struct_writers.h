@@ -7,5 +7,6 @@ namespace swiftwinrt
     void write_struct_init_extension(writer& w, struct_type const& type);
     void write_struct(writer& w, struct_type const& type);
     void write_struct_bridgeable(writer& w, struct_type const& type);
+    void write_struct_blittable_conformance(writer& w, struct_type const& type);
     void write_struct_abi(writer& w, struct_type const& type);
 }
\ No newline at end of file
@@ -43,7 +43,7 @@ namespace swiftwinrt
             get<uint8_t>(get<ElemSig>(args[10].value).value));
     }
 
-    static void write_guid_value_hash(writer& w, std::array<uint8_t, 20ui64> const& iidHash)
+    static void write_guid_value_hash(writer& w, std::array<uint8_t, 20> const& iidHash)
     {
         w.write_printf("Data1: 0x%02x%02x%02x%02x, Data2: 0x%02x%02x, Data3: 0x%02x%02x, Data4: ( 0x%02x,0x%02x,0x%02x,0x%02x,0x%02x,0x%02x,0x%02x,0x%02x )",
             iidHash[0], iidHash[1], iidHash[2], iidHash[3],
@@ -53,7 +53,7 @@ namespace swiftwinrt
             iidHash[10], iidHash[11], iidHash[12], iidHash[13], iidHash[14], iidHash[15]);
     }
 
-    static void write_guid_comment_hash(writer& w, std::array<uint8_t, 20ui64> const& iidHash)
+    static void write_guid_comment_hash(writer& w, std::array<uint8_t, 20> const& iidHash)
     {
         w.write_printf("%02x%02x%02x%02x-%02x%02x-%02x%02x-%02x%02x-%02x%02x%02x%02x%02x%02x",
             iidHash[0], iidHash[1], iidHash[2], iidHash[3],
@@ -134,7 +134,7 @@ namespace swiftwinrt
         {
             if (!is_out)
             {
-                w.write("%.get()", local_name);
+                w.write("%", local_name);
             }
             else
             {
@@ -321,7 +321,7 @@ namespace swiftwinrt
     }
 
     static void write_consume_return_statement(writer& w, function_def const& signature);
-    static void write_return_type_declaration(writer& w, function_def function, write_type_params const& type_params)
+    static void write_return_type_declaration(writer& w, function_def const& function, write_type_params const& type_params)
     {
         if (!function.return_type)
         {
@@ -421,7 +421,7 @@ namespace swiftwinrt
             return;
         }
 
-        auto return_type = signature.return_type.value();
+        auto const& return_type = signature.return_type.value();
         auto return_param_name = put_in_backticks_if_needed(std::string(return_type.name));
         if (return_type.is_array())
         {
@@ -529,15 +529,15 @@ namespace swiftwinrt
 
     public var value: Any { _value }
 
-    public func getUInt8() -> UInt8 { _value as! UInt8 }
-    public func getInt16() -> Int16 { _value as! Int16 }
-    public func getUInt16() -> UInt16 { _value as! UInt16 }
-    public func getInt32() -> Int32 { _value as! Int32 }
-    public func getUInt32() -> UInt32 { _value as! UInt32 }
-    public func getInt64() -> Int64 { _value as! Int64 }
-    public func getUInt64() -> UInt64 { _value as! UInt64 }
-    public func getSingle() -> Float { _value as! Float }
-    public func getDouble() -> Double { _value as! Double }
+    public func getUInt8() throws -> UInt8 { try PropertyValue.number(_value) }
+    public func getInt16() throws -> Int16 { try PropertyValue.number(_value) }
+    public func getUInt16() throws -> UInt16 { try PropertyValue.number(_value) }
+    public func getInt32() throws -> Int32 { try PropertyValue.number(_value) }
+    public func getUInt32() throws -> UInt32 { try PropertyValue.number(_value) }
+    public func getInt64() throws -> Int64 { try PropertyValue.number(_value) }
+    public func getUInt64() throws -> UInt64 { try PropertyValue.number(_value) }
+    public func getSingle() throws -> Float { try PropertyValue.number(_value) }
+    public func getDouble() throws -> Double { try PropertyValue.number(_value) }
     public func getChar16() -> Character { _value as! Character }
     public func getBoolean() -> Bool { _value as! Bool }
     public func getString() -> String { _value as! String }
@@ -573,6 +573,43 @@ namespace swiftwinrt
 
     }
 
+    // Element types which GetMany can fill in place, starting from an array of default values. Characters and
+    // booleans are left out since their default values aren't cheap to marshal, and neither are those of
+    // structs which need converting field by field.
+    static bool can_get_many(metadata_type const& element)
+    {
+        TypeDef signature_type{};
+        switch (get_category(&element, &signature_type))
+        {
+        case param_category::generic_type:
+        case param_category::object_type:
+        case param_category::string_type:
+        case param_category::enum_type:
+        case param_category::fundamental_type:
+            return true;
+        case param_category::struct_type:
+            return is_struct_blittable(signature_type);
+        default:
+            return false;
+        }
+    }
+
+    // Iterating goes through VectorIterator, which fetches elements with GetMany a batch at a time, rather than
+    // the default IndexingIterator, which makes a GetAt call for each element
+    static void write_vector_iterator(writer& w, generic_inst const& vector, std::string_view modifier)
+    {
+        auto&& element = *vector.generic_params()[0];
+        if (!can_get_many(element))
+        {
+            return;
+        }
+
+        w.write(R"(%func makeIterator() -> %.VectorIterator<Element> {
+    .init(self, placeholder: %)
+}
+)", modifier, w.support, bind<write_default_value>(element, projection_layer::swift));
+    }
+
     // Due to https://linear.app/the-browser-company/issue/WIN-148/investigate-possible-compiler-bug-crash-when-generating-collection
     // we have to generate the protocol conformance for the Collection protocol (see "// MARK: Collection" below). We shouldn't have to
     // do this because we define an extension on the protocol which does this.
@@ -598,6 +635,10 @@ namespace swiftwinrt
 }
 %var count: Int { Int(size) }
 )", modifier, modifier, modifier, modifier, modifier, modifier);
+            if (auto vector = dynamic_cast<const generic_inst*>(info.type))
+            {
+                write_vector_iterator(w, *vector, modifier);
+            }
             if (typeName.starts_with("IVectorView"))
             {
                 w.write(R"(
@@ -717,6 +758,23 @@ namespace swiftwinrt
                     guard.insert_front("% = %\n", param_name, bind<write_convert_array_from_abi>(*param.type, local_param_name));
                     guard.insert_front("defer { CoTaskMemFree(%.start) }\n", local_param_name);
                 }
+                else if (!param.in() && (category == param_category::string_type || is_reference_type(param.type)))
+                {
+                    // The callee fills the buffer with elements which the caller then owns, so rather than
+                    // marshaling the array in and adding a reference to each element on the way out, this passes
+                    // an empty buffer and takes over the elements written to it
+                    if (is_reference_type(param.type))
+                    {
+                        w.write("try %.fillFromAbi(abiBridge: %.self) { % in\n", param_name, bind_bridge_name(*param.type), local_param_name);
+                    }
+                    else
+                    {
+                        w.write("try %.fillFromAbi { % in\n", param_name, local_param_name);
+                    }
+
+                    guard.push("}\n");
+                    guard.push_indent();
+                }
                 else
                 {
                     // Array is passed by reference, so we need to convert the input to a buffer and then pass that buffer to C, then convert the buffer back to an array
@@ -746,9 +804,13 @@ namespace swiftwinrt
             {
                 if (category == param_category::string_type)
                 {
-                    w.write("let % = try! HString(%)\n",
-                        local_param_name,
-                        param_name);
+                    // Pass a fast-pass reference to the string rather than copying it into a new HSTRING. The
+                    // reference is only valid inside of the closure, so the rest of the call goes in there too.
+                    w.write("try %.withHStringRef { % in\n",
+                        param_name,
+                        local_param_name);
+                    guard.push_closing("}\n");
+                    guard.push_indent();
                 }
                 else if (category == param_category::struct_type && !is_struct_blittable(signature_type))
                 {
@@ -831,25 +893,100 @@ namespace swiftwinrt
         return guard;
     }
 
+    // With -eager-interfaces, sealed classes matching one of the given prefixes query their interfaces once, at
+    // construction, into a non-optional _Interfaces struct rather than lazily on first use. Composable classes
+    // are excluded since the interfaces of an aggregated object can only be queried once the outer object exists.
+    static bool resolves_interfaces_eagerly(class_type const& type)
+    {
+        if (settings.eager_interfaces.empty() || type.is_composable() || !type.default_interface)
+        {
+            return false;
+        }
+
+        auto name = get_full_type_name(type);
+        for (auto&& prefix : settings.eager_interfaces)
+        {
+            if (name.starts_with(prefix))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Interfaces added to a class in a later version of its contract are missing from objects created by an older OS,
+    // so only those the class was introduced with are resolved eagerly. That's recorded on the class's InterfaceImpl
+    // row rather than on the interface, which may well be older than the class. Without a version there, or with one
+    // from later on, the interface is still queried on first use.
+    static bool resolves_interface_eagerly(class_type const& type, interface_info const& info)
+    {
+        if (!resolves_interfaces_eagerly(type))
+        {
+            return false;
+        }
+
+        if (info.is_default)
+        {
+            return true;
+        }
+
+        if (!info.impl || info.impl.Class() != type.type())
+        {
+            return false;
+        }
+
+        auto class_introduced = get_initial_contract_version(type.type());
+        if (auto attr = get_attribute(info.impl, metadata_namespace, "ContractVersionAttribute"))
+        {
+            auto impl_introduced = decode_contract_version_attribute(attr);
+            return impl_introduced.name == class_introduced.name && impl_introduced.version <= class_introduced.version;
+        }
+
+        bool introduced_with_class = false;
+        if (class_introduced.name.empty())
+        {
+            for_each_attribute(info.impl, metadata_namespace, "VersionAttribute", [&](bool, auto const& attr)
+            {
+                auto impl_introduced = decode_platform_version(attr);
+                if (impl_introduced.platform == meta_platform::windows && impl_introduced.version <= class_introduced.version)
+                {
+                    introduced_with_class = true;
+                }
+            });
+        }
+        return introduced_with_class;
+    }
+
+    // Initializes the class from a newly created or wrapped object, resolving its interfaces first if the class
+    // does so eagerly
+    static void write_class_super_init(writer& w, class_type const& type, std::string_view abi)
+    {
+        auto super_init = type.base_class ? "super.init(fromAbi: %)\n" : "super.init(%)\n";
+        if (!resolves_interfaces_eagerly(type))
+        {
+            w.write(super_init, abi);
+            return;
+        }
+
+        if (abi != "fromAbi")
+        {
+            w.write("let abi = %\n", abi);
+            abi = "abi";
+        }
+        w.write("_interfaces = .init(%)\n", abi);
+        w.write(super_init, abi);
+    }
+
     static void write_factory_body(writer& w, function_def const& method, interface_info const& factory, class_type const& type, metadata_type const& default_interface)
     {
         std::string_view func_name = get_abi_name(method);
 
         auto swift_name = get_swift_name(factory);
-        auto return_name = method.return_type.value().name;
         auto func_call = w.write_temp("try! Self.%.%(%)",
             swift_name,
             func_name,
             bind<write_implementation_args>(method));
-        if (auto base_class = type.base_class)
-        {
-            w.write("super.init(fromAbi: %)\n", func_call);
-        }
-        else
-        {
-            w.write("super.init(%)\n", func_call);
-        }
-
+        write_class_super_init(w, type, func_call);
     }
 
     // Check if the type has a default constructor. This is a parameterless constructor
@@ -1144,7 +1281,8 @@ namespace swiftwinrt
                 w.write("%.fill(abi: %, abiBridge: %.self)\n",
                     param_name, return_param_name, bind_bridge_fullname(*type));
             }
-            else if (category == param_category::enum_type || category == param_category::fundamental_type)
+            else if (category == param_category::enum_type || category == param_category::fundamental_type ||
+                (category == param_category::struct_type && is_struct_blittable(signature_type)))
             {
                 w.write("%.fill(abi: %)\n",
                     param_name, return_param_name);
@@ -1191,7 +1329,7 @@ namespace swiftwinrt
         );
     }
 
-    static void write_abi_ret_val(writer& w, function_def signature)
+    static void write_abi_ret_val(writer& w, function_def const& signature)
     {
         int param_number = 1;
         for (auto& param : signature.params)
@@ -1332,7 +1470,7 @@ namespace swiftwinrt
     }
 
     template <typename T>
-    static void write_vtable_body(writer& w, T const& type, std::vector<named_interface_info> interfaces)
+    static void write_vtable_body(writer& w, T const& type, std::vector<named_interface_info> const& interfaces)
     {
         constexpr bool isInterface = std::is_same_v<T, interface_type>;
         constexpr bool isDelegate = std::is_same_v<T, delegate_type>;
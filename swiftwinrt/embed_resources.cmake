@@ -0,0 +1,58 @@
+# Generates a C++ source which embeds the files listed in resources.rc as byte arrays, for builds
+# that don't have the win32 resource compiler. Invoked at build time as:
+#   cmake -DRESOURCES_RC=<resources.rc> -DRESOURCES_H=<resources.h> -DOUTPUT=<file.cpp> -P embed_resources.cmake
+
+# resources.rc refers to some names and types through the macros in resources.h
+file(STRINGS ${RESOURCES_H} defines REGEX "^#define [A-Z0-9_]+ [A-Z0-9_]+$")
+foreach(define IN LISTS defines)
+    string(REGEX MATCH "^#define ([A-Z0-9_]+) ([A-Z0-9_]+)$" unused "${define}")
+    set(macro_${CMAKE_MATCH_1} ${CMAKE_MATCH_2})
+endforeach()
+
+get_filename_component(resources_root ${RESOURCES_RC} ABSOLUTE)
+get_filename_component(resources_root ${resources_root} DIRECTORY)
+file(STRINGS ${RESOURCES_RC} resources REGEX "^[^ #]+ [A-Z0-9_]+ \".+\"$")
+
+set(arrays "")
+set(entries "")
+set(index 0)
+foreach(resource IN LISTS resources)
+    string(REGEX MATCH "^([^ ]+) ([A-Z0-9_]+) \"(.+)\"$" unused "${resource}")
+    set(name ${CMAKE_MATCH_1})
+    set(type ${CMAKE_MATCH_2})
+    set(path ${CMAKE_MATCH_3})
+
+    if(DEFINED macro_${name})
+        set(name ${macro_${name}})
+    endif()
+    if(DEFINED macro_${type})
+        set(type ${macro_${type}})
+    endif()
+
+    # the resource compiler upper cases string names, so do the same to get identical output
+    string(TOUPPER ${name} name)
+    string(REPLACE "\\\\" "/" path "${path}")
+
+    file(READ ${resources_root}/${path} bytes HEX)
+    string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," bytes "${bytes}")
+
+    string(APPEND arrays "    static unsigned char const resource_${index}[] = { ${bytes} };\n")
+    string(APPEND entries "        { \"${type}\", \"${name}\", std::as_bytes(std::span{ resource_${index} }) },\n")
+    math(EXPR index "${index} + 1")
+endforeach()
+
+file(WRITE ${OUTPUT} "// Generated from resources.rc by embed_resources.cmake
+
+#include \"pch.h\"
+#include \"resources.h\"
+
+namespace swiftwinrt
+{
+${arrays}
+    static embedded_resource const embedded_resources_table[] =
+    {
+${entries}    };
+
+    std::span<const embedded_resource> const embedded_resources{ embedded_resources_table };
+}
+")
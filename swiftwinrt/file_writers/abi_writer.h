@@ -108,6 +108,14 @@ namespace swiftwinrt
         return !removed_types.contains(type.swift_full_name());
     }
 
+    // Header with forward declarations for every interface and delegate in the metadata, used
+    // when the C headers are filtered. Its contents only depend on the input metadata.
+    static constexpr std::string_view abi_forward_header_name = "CWinRT.Forward";
+
+    // Header holding every generic instantiation used by the C headers, used when the generic
+    // definitions are shared instead of being repeated in each namespace header.
+    static constexpr std::string_view abi_generics_header_name = "CWinRT.Generics";
+
     static void write_includes(writer& w, type_cache const& types, std::string_view fileName)
     {
         // Forced dependencies
@@ -117,6 +125,12 @@ namespace swiftwinrt
 #include <windowscontracts.h>
 )^-^");
 
+        if (settings.abi_filter)
+        {
+            w.write(R"^-^(#include "%.h"
+)^-^", abi_forward_header_name);
+        }
+
         if (fileName != winrt_foundation_namespace)
         {
             w.write(R"^-^(#include "Windows.Foundation.h"
@@ -188,6 +202,25 @@ namespace swiftwinrt
 
     static void write_c_generic_definitions(writer& w, type_cache const& types)
     {
+        if (settings.abi_shared_generics)
+        {
+            // the definitions are in the shared header, which the umbrella header includes after every namespace
+            // header, so here the instantiations are only declared for the interfaces which use them
+            if (!types.generic_instantiations.empty())
+            {
+                w.write("// Parameterized interface forward declarations (C)\n");
+                for (auto const& [name, inst] : types.generic_instantiations)
+                {
+                    if (should_write(inst.get()))
+                    {
+                        w.write("typedef interface % %;\n", inst.get().mangled_name(), inst.get().mangled_name());
+                    }
+                }
+                w.write("\n");
+            }
+            return;
+        }
+
         w.write(R"^-^(// Parameterized interface forward declarations (C)
 
 // Collection interface definitions
@@ -284,7 +317,81 @@ namespace swiftwinrt
         w.save_header();
     }
 
-    inline void write_include_all(std::map<std::string_view, winmd::reader::cache::namespace_members> const& namespaces)
+    inline void write_abi_forward_header(metadata_cache const& mdCache)
+    {
+        writer w;
+        w.type_namespace = abi_forward_header_name;
+        write_preamble(w, /* swift_code: */ false);
+
+        w.write("#pragma once\n");
+        w.write(R"^-^(#include <inspectable.h>
+
+)^-^");
+
+        for (auto const& [ns, members] : mdCache.namespaces)
+        {
+            for (auto const& type : members.delegates)
+            {
+                if (!type.is_generic() && should_write(type))
+                {
+                    type.write_c_forward_declaration(w);
+                }
+            }
+
+            for (auto const& type : members.interfaces)
+            {
+                if (!type.is_generic() && should_write(type))
+                {
+                    type.write_c_forward_declaration(w);
+                }
+            }
+        }
+
+        w.save_header();
+    }
+
+    inline void write_abi_generics_header(metadata_cache const& mdCache, std::set<std::string_view> const& namespaces, metadata_filter const& filter)
+    {
+        std::map<std::string_view, generic_inst const*> generics;
+        for (auto ns : namespaces)
+        {
+            auto itr = mdCache.namespaces.find(ns);
+            if (itr == mdCache.namespaces.end())
+            {
+                continue;
+            }
+
+            for (auto const& [name, inst] : itr->second.generic_instantiations)
+            {
+                if (filter.includes_generic(name) && should_write(inst))
+                {
+                    generics.emplace(name, &inst);
+                }
+            }
+        }
+
+        writer w;
+        w.type_namespace = abi_generics_header_name;
+        write_preamble(w, /* swift_code: */ false);
+
+        w.write(R"^-^(#pragma once
+#include <inspectable.h>
+#include <EventToken.h>
+#include "IVectorChangedEventArgs.h"
+
+)^-^");
+
+        // Only the umbrella header includes this, after every namespace header, so the structs and enums which the
+        // instantiations take by value are defined by then whichever namespaces they come from
+        for (auto const& [name, inst] : generics)
+        {
+            inst->write_c_forward_declaration(w);
+        }
+
+        w.save_header();
+    }
+
+    inline void write_include_all(std::set<std::string_view> const& namespaces)
     {
         writer w;
         w.c_mod = settings.get_c_module_name();
@@ -316,15 +423,22 @@ namespace swiftwinrt
 #include "CppInteropWorkaround.h" // TODO(WIN-860): Remove workaround once C++ interop issues with WinSDK.GUID are fixed.
 #include "MemoryBuffer.h" // IMemoryBufferByteAccess (C definition)
 #include "WeakReference.h" // IWeakReference[Source] (C definition)
+#include "ReferenceBox.h" // IReference<T> for any T (C definition)
 #include "robuffer.h" // IBufferByteAccess (C definition)
 )");
-        for (auto& [ns, members] : namespaces)
+        if (settings.abi_filter)
         {
-            if (has_projected_types(members))
-            {
-                w.write("#include \"%.h\"\n", ns);
+            w.write("#include \"%.h\"\n", abi_forward_header_name);
+        }
 
-            }
+        for (auto& ns : namespaces)
+        {
+            w.write("#include \"%.h\"\n", ns);
+        }
+
+        if (settings.abi_shared_generics)
+        {
+            w.write("#include \"%.h\" // parameterized interface definitions (C)\n", abi_generics_header_name);
         }
 
         w.write("#pragma clang diagnostic pop\n");
@@ -5,6 +5,8 @@
 #include <regex>
 #include <span>
 
+#include "utility/perfect_hash.h"
+#include "utility/profiling.h"
 #include "utility/swift_codegen_utils.h"
 
 namespace swiftwinrt
@@ -53,7 +55,7 @@ namespace swiftwinrt
         create_directories(dir_path);
 
         auto support_files = get_named_resources_of_type(
-            GetModuleHandle(NULL), RESOURCE_TYPE_SWIFT_SUPPORT_FILE_STR, /* make_lowercase: */ true);
+            RESOURCE_TYPE_SWIFT_SUPPORT_FILE_STR, /* make_lowercase: */ true);
         for (const auto& support_file : support_files)
         {
             auto path = dir_path / (support_file.first + ".swift");
@@ -81,9 +83,11 @@ namespace swiftwinrt
         fill_template_placeholders_to_file(memorybuffer_h_template, dir_path / "include" / "MemoryBuffer.h");
         auto weakreference_h_template = find_resource(RESOURCE_TYPE_OTHER_FILE_STR, RESOURCE_NAME_CWINRT_WEAKREFERENCE_H_STR);
         fill_template_placeholders_to_file(weakreference_h_template, dir_path / "include" / "WeakReference.h");
+        auto referencebox_h_template = find_resource(RESOURCE_TYPE_OTHER_FILE_STR, RESOURCE_NAME_CWINRT_REFERENCEBOX_H_STR);
+        fill_template_placeholders_to_file(referencebox_h_template, dir_path / "include" / "ReferenceBox.h");
 
         auto support_files = get_named_resources_of_type(
-            GetModuleHandle(nullptr), RESOURCE_TYPE_C_INCLUDE_FILE_STR, /* make_lowercase: */ true);
+            RESOURCE_TYPE_C_INCLUDE_FILE_STR, /* make_lowercase: */ true);
         for (const auto& support_file : support_files)
         {
             auto path = dir_path / "include" / (support_file.first + ".h");
@@ -232,6 +236,68 @@ namespace swiftwinrt
         write_enum_extension(w, type);
     }
 
+    struct namespace_type_text
+    {
+        std::string text;
+        std::set<std::string> depends;
+    };
+
+    // Namespaces below this much Swift aren't worth splitting, since each file adds to swiftc's own overhead
+    static constexpr std::size_t min_namespace_part_size = 64 * 1024;
+
+    // With -split-namespaces, the types of a large namespace are spread over several files so that swiftc can type
+    // check them in parallel. Each type goes into the smallest part so far, largest type first, and the types of a
+    // part keep the order they're written in. The first part is <Namespace>.swift and the others <Namespace>+PartN.swift.
+    static void write_namespace_parts(writer& w, std::vector<namespace_type_text> const& types)
+    {
+        std::size_t total{};
+        for (auto&& type : types)
+        {
+            total += type.text.size();
+        }
+
+        std::size_t parts = std::clamp<std::size_t>(total / min_namespace_part_size, 1, settings.split_namespaces);
+        parts = std::max<std::size_t>(std::min(parts, types.size()), 1);
+
+        std::vector<std::size_t> part_of(types.size());
+        if (parts > 1)
+        {
+            std::vector<std::size_t> order(types.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](std::size_t lhs, std::size_t rhs)
+            {
+                return types[lhs].text.size() > types[rhs].text.size();
+            });
+
+            std::vector<std::size_t> part_sizes(parts);
+            for (auto type : order)
+            {
+                auto part = std::min_element(part_sizes.begin(), part_sizes.end()) - part_sizes.begin();
+                part_of[type] = part;
+                part_sizes[part] += types[type].text.size();
+            }
+        }
+
+        for (std::size_t part = 0; part < parts; ++part)
+        {
+            for (std::size_t type = 0; type < types.size(); ++type)
+            {
+                if (part_of[type] == part)
+                {
+                    w.write(types[type].text);
+                    w.depends.insert(types[type].depends.begin(), types[type].depends.end());
+                }
+            }
+
+            write_preamble_and_save(w, part == 0 ? "" : "Part" + std::to_string(part + 1));
+        }
+
+        // a namespace split over fewer files than before would otherwise keep declaring its types in the old ones
+        for (auto part = parts + 1; std::filesystem::remove(w.file_path("Part" + std::to_string(part))); ++part)
+        {
+        }
+    }
+
     static void write_namespace_types(std::string_view const& ns, type_cache const& members, include_only_used_filter const& filter)
     {
         writer w;
@@ -242,43 +308,48 @@ namespace swiftwinrt
         w.swift_module = get_swift_module(ns);
         w.cache = members.cache;
 
+        // each type is written apart, along with its imports, so that they can be split between files
+        std::vector<namespace_type_text> types;
+        auto write_member = [&](auto const& type, auto write_type)
+        {
+            types_written.add();
+            w.write("// MARK: - %\n\n", type.swift_type_name());
+            write_type(w, ns, type);
+            types.push_back({ w.flush_to_string(), std::exchange(w.depends, {}) });
+        };
+
         for (auto&& member : members.enums)
         {
-            if (!filter.includes(member.get().type())) continue;
-            w.write("// MARK: - %\n\n", member.get().swift_type_name());
-            write_namespace_enum(w, ns, member.get());
+            if (!filter.includes(member.get())) continue;
+            write_member(member.get(), write_namespace_enum);
         }
 
         for (auto&& member : members.structs)
         {
-            if (!filter.includes(member.get().type())) continue;
-            w.write("// MARK: - %\n\n", member.get().swift_type_name());
-            write_namespace_struct(w, ns, member.get());
+            if (!filter.includes(member.get())) continue;
+            write_member(member.get(), write_namespace_struct);
         }
 
         for (auto&& member : members.delegates)
         {
-            if (!filter.includes(member.get().type())) continue;
-            w.write("// MARK: - %\n\n", member.get().swift_type_name());
-            write_namespace_delegate(w, ns, member.get());
+            if (!filter.includes(member.get())) continue;
+            write_member(member.get(), write_namespace_delegate);
         }
 
         for (auto&& member : members.interfaces)
         {
             // Don't write exclusive interfaces here, those are handled by the class
-            if (!filter.includes(member.get().type()) || is_exclusive(member)) continue;
-            w.write("// MARK: - %\n\n", member.get().swift_type_name());
-            write_namespace_interface(w, ns, member.get());
+            if (!filter.includes(member.get()) || is_exclusive(member)) continue;
+            write_member(member.get(), write_namespace_interface);
         }
 
         for (auto&& member : members.classes)
         {
-            if (!filter.includes(member.get().type())) continue;
-            w.write("// MARK: - %\n\n", member.get().swift_type_name());
-            write_namespace_class(w, ns, member.get());
+            if (!filter.includes(member.get())) continue;
+            write_member(member.get(), write_namespace_class);
         }
 
-        write_preamble_and_save(w, "");
+        write_namespace_parts(w, types);
     }
 
     // All write_namespace_impl does is define the impl enum so that all other usages can be extensions to that type. This is
@@ -301,8 +372,23 @@ namespace swiftwinrt
         w.save_file("Impl");
     }
 
-    static void write_module_generics(std::string_view const& module, type_cache const& members, include_only_used_filter const& filter)
+    static void write_module_generic(writer& w, generic_inst const& inst)
     {
+        write_guid_generic(w, inst);
+        write_generic_extension(w, inst);
+        write_interface_generic(w, inst);
+        auto impl_names = w.push_impl_names(true);
+        write_generic_implementation(w, inst);
+    }
+
+    // With -shared-generics, the instantiations which another module owns are left for it to write, and the ones
+    // this module owns are written for every module using them (see assign_generic_owners)
+    static void write_module_generics(std::string_view const& module, type_cache const& members, include_only_used_filter const& filter,
+        std::map<std::string_view, generic_inst const*> const& owned_generics)
+    {
+        static profile_counter shared{ "generic instantiations shared" };
+        static profile_counter shared_bytes{ "generic instantiation bytes shared" };
+
         writer w;
         w.filter = filter;
         w.support = settings.support;
@@ -311,13 +397,29 @@ namespace swiftwinrt
         w.swift_module = module;
         w.cache = members.cache;
 
-        for (auto& [_, inst] : members.generic_instantiations)
+        auto generics = owned_generics;
+        for (auto& [name, inst] : members.generic_instantiations)
         {
-            write_guid_generic(w, inst.get());
-            write_generic_extension(w, inst.get());
-            write_interface_generic(w, inst.get());
-            auto impl_names = w.push_impl_names(true);
-            write_generic_implementation(w, inst.get());
+            auto owner = settings.generic_owners.find(name);
+            if (owner == settings.generic_owners.end() || owner->second == module)
+            {
+                generics.emplace(name, &inst.get());
+                continue;
+            }
+
+            shared.add();
+            if (settings.profile)
+            {
+                // what this module would have written had it not been shared, without the imports it would need
+                auto depends = w.depends;
+                shared_bytes.add(w.write_temp("%", bind<write_module_generic>(inst.get())).size());
+                w.depends = std::move(depends);
+            }
+        }
+
+        for (auto& [_, inst] : generics)
+        {
+            write_module_generic(w, *inst);
         }
 
         for (auto& [_, eventType] : members.implementable_event_types)
@@ -332,4 +434,99 @@ namespace swiftwinrt
         write_preamble(w, /* swift_code: */ true);
         w.save_file("Generics");
     }
+
+    // Maps the runtime class names of a module to their makers so that makeFrom(abi:) can find the Swift type
+    // for an object without going through NSClassFromString. The names are laid out by a perfect hash, which
+    // the support module computes the same way at runtime (see MakerTable).
+    static void write_module_makers(std::string_view const& module, type_cache const& members, include_only_used_filter const& filter)
+    {
+        writer w;
+        w.filter = filter;
+        w.support = settings.support;
+        w.c_mod = settings.get_c_module_name();
+        w.type_namespace = module;
+        w.swift_module = module;
+        w.cache = members.cache;
+
+        std::vector<std::pair<std::string, typedef_base const*>> makers;
+        auto add_maker = [&](typedef_base const& type)
+        {
+            if (filter.includes(type) && !skip_write_from_abi(w, type))
+            {
+                makers.emplace_back(get_full_type_name(type), &type);
+            }
+        };
+
+        for (auto&& member : members.interfaces)
+        {
+            add_maker(member.get());
+        }
+
+        for (auto&& member : members.classes)
+        {
+            add_maker(member.get());
+        }
+
+        if (makers.empty())
+        {
+            return;
+        }
+
+        // sorted so that the table doesn't depend on the order the namespaces were compiled in
+        std::sort(makers.begin(), makers.end(), [](auto const& lhs, auto const& rhs)
+        {
+            return lhs.first < rhs.first;
+        });
+
+        std::vector<std::u16string> keys;
+        keys.reserve(makers.size());
+        for (auto&& [name, _] : makers)
+        {
+            keys.push_back(to_utf16(name));
+        }
+
+        auto hash = build_perfect_hash(keys, [](std::u16string const& key, uint32_t seed)
+        {
+            return utf16_hash(key, seed);
+        });
+
+        std::vector<std::pair<std::string, typedef_base const*> const*> slots(makers.size());
+        for (std::size_t i = 0; i < makers.size(); ++i)
+        {
+            slots[hash.slots[i]] = &makers[i];
+        }
+
+        w.write(R"(@_spi(WinRTInternal)
+public final class __MakerTable: MakerTable {
+    public static let seeds: [UInt32] = [
+)");
+        for (std::size_t i = 0; i < hash.seeds.size(); i += 16)
+        {
+            w.write("        ");
+            for (std::size_t j = i; j < std::min(i + 16, hash.seeds.size()); ++j)
+            {
+                w.write(j == i ? "%," : " %,", std::to_string(hash.seeds[j]));
+            }
+            w.write("\n");
+        }
+        w.write("    ]\n");
+
+        w.write("    public static let names: [String] = [\n");
+        for (auto slot : slots)
+        {
+            w.write("        \"%\",\n", slot->first);
+        }
+        w.write("    ]\n");
+
+        w.write("    public static let makers: [any MakeFromAbi.Type] = [\n");
+        for (auto slot : slots)
+        {
+            w.write("        %Maker.self,\n", slot->second->swift_type_name());
+        }
+        w.write("    ]\n}\n");
+
+        w.swap();
+        write_preamble(w, /* swift_code: */ true);
+        w.save_file("Makers");
+    }
 }
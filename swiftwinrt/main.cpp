@@ -5,11 +5,16 @@
 #pragma warning(push)
 #pragma warning (disable: 4505)
 #include <ctime>
+#include <cstdlib>
+#include <new>
 #include "utility/metadata_cache.h"
 #include "utility/metadata_filter.h"
 #include "utility/metadata_helpers.h"
 #include "utility/type_helpers.h"
 #include "utility/settings.h"
+#include "utility/sharding.h"
+#include "utility/profiling.h"
+#include "utility/generator_server.h"
 #include "utility/swift_codegen_utils.h"
 #include "utility/versioning.h"
 #include "types.h"
@@ -19,6 +24,31 @@
 #include "file_writers/file_writers.h"
 #pragma warning(pop)
 
+// Replaced so that -profile can count heap allocations, see write_profile
+void* operator new(std::size_t size)
+{
+    if (swiftwinrt::count_allocations.load(std::memory_order_relaxed))
+    {
+        swiftwinrt::allocation_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (auto result = std::malloc(size == 0 ? 1 : size))
+    {
+        return result;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
 namespace swiftwinrt
 {
     settings_type settings;
@@ -51,6 +81,18 @@ namespace swiftwinrt
         { "fastabi", 0, 0 }, // Enable support for the Fast ABI
         { "ignore_velocity", 0, 0 }, // Ignore feature staging metadata and always include implementations
         { "synchronous", 0, 0 }, // Instructs cppwinrt to run on a single thread to avoid file system issues in batch builds
+        { "abi-filter", 0, 0, {}, "Only write C ABI declarations for types reachable from the projection" },
+        { "abi-shared-generics", 0, 0, {}, "Write C ABI generic instantiations once into a shared header" },
+        { "shard", 0, 1, "<index/count>", "Only generate this shard's part of the projection, plus a manifest" },
+        { "merge", 0, 0, {}, "Write the shared outputs once every shard has been generated" },
+        { "serve", 0, 1, "<name>", "Keep metadata loaded and serve generation requests from -connect" },
+        { "connect", 0, 1, "<name>", "Generate using the -serve process with this name if one is running" },
+        { "profile", 0, 0, {}, "Report the time spent in, and the counts of, the generator's main phases" },
+        { "factory-cache", 0, 0, {}, "Resolve activation factories through the support module's shared ActivationFactoryCache" },
+        { "eager-interfaces", 0, option::no_max, "<prefix>", "Resolve the interfaces of matching sealed classes once at construction" },
+        { "inlinable-abi", 0, 0, {}, "Write the ABI thunks and blittable struct conversions as @inlinable so other modules can inline them" },
+        { "shared-generics", 0, 0, {}, "Write each generic instantiation used by several modules once, into the module which owns it" },
+        { "split-namespaces", 0, 1, "<count>", "Spread the types of each large namespace over up to this many files" },
     };
 
     static void print_usage(writer& w)
@@ -89,11 +131,43 @@ Where <spec> is one or more of:
         w.write(format, SWIFTWINRT_VERSION_STRING, bind_each(printOption, options));
     }
 
+    static uint32_t parse_split_namespaces(std::string const& value)
+    {
+        if (value.empty() || !std::all_of(value.begin(), value.end(), [](char c) { return std::isdigit(static_cast<unsigned char>(c)); }))
+        {
+            throw_invalid("Split count '", value, "' must be a number");
+        }
+
+        auto count = static_cast<uint32_t>(std::stoul(value));
+        if (count == 0)
+        {
+            throw_invalid("Split count '", value, "' must be at least 1");
+        }
+        return count;
+    }
+
     static void process_args(reader const& args)
     {
         settings.log = args.exists("log");
         settings.verbose = settings.log || args.exists("verbose");
         settings.fastabi = args.exists("fastabi");
+        settings.abi_filter = args.exists("abi-filter");
+        settings.abi_shared_generics = args.exists("abi-shared-generics");
+
+        if (args.exists("shard"))
+        {
+            std::tie(settings.shard_index, settings.shard_count) = parse_shard(args.value("shard"));
+        }
+        settings.merge = args.exists("merge");
+        settings.profile = args.exists("profile");
+        settings.factory_cache = args.exists("factory-cache");
+        settings.inlinable_abi = args.exists("inlinable-abi");
+        settings.shared_generics = args.exists("shared-generics");
+        settings.split_namespaces = args.exists("split-namespaces") ? parse_split_namespaces(args.value("split-namespaces")) : 1;
+        if (settings.merge && settings.shard_count != 0)
+        {
+            throw_invalid("Options '-shard' and '-merge' can't be combined");
+        }
 
         settings.input = args.files("input", database::is_database);
         settings.reference = args.files("reference", database::is_database);
@@ -123,6 +197,11 @@ Where <spec> is one or more of:
         {
             settings.exclude.insert(exclude);
         }
+
+        for (auto && prefix : args.values("eager-interfaces"))
+        {
+            settings.eager_interfaces.insert(prefix);
+        }
     }
 
     static auto get_files_to_cache()
@@ -133,6 +212,40 @@ Where <spec> is one or more of:
         return files;
     }
 
+    // Everything which changes what the shards generate, see shard_fingerprint
+    static std::string get_shard_fingerprint()
+    {
+        shard_fingerprint fingerprint;
+        for (auto&& file : get_files_to_cache())
+        {
+            fingerprint.add(static_cast<uint64_t>(std::filesystem::file_size(file)));
+            fingerprint.add_contents(file);
+        }
+        for (auto&& include : settings.include)
+        {
+            fingerprint.add("include " + include);
+        }
+        for (auto&& exclude : settings.exclude)
+        {
+            fingerprint.add("exclude " + exclude);
+        }
+        for (auto&& prefix : settings.eager_interfaces)
+        {
+            fingerprint.add("eager-interfaces " + prefix);
+        }
+        fingerprint.add(settings.support);
+        fingerprint.add(settings.license);
+        fingerprint.add(settings.brackets);
+        fingerprint.add(settings.fastabi);
+        fingerprint.add(settings.abi_filter);
+        fingerprint.add(settings.abi_shared_generics);
+        fingerprint.add(settings.factory_cache);
+        fingerprint.add(settings.inlinable_abi);
+        fingerprint.add(settings.shared_generics);
+        fingerprint.add(settings.split_namespaces);
+        return fingerprint.str();
+    }
+
     static void build_filters(cache const& c)
     {
         std::set<std::string> include;
@@ -195,7 +308,176 @@ Where <spec> is one or more of:
         }
     }
 
-    static int run(int const argc, char** argv)
+    static void add_generic_modules(generic_inst const& inst, std::set<std::string_view>& modules)
+    {
+        modules.insert(get_swift_module(inst.swift_logical_namespace()));
+        for (auto param : inst.generic_params())
+        {
+            if (auto nested = dynamic_cast<generic_inst const*>(param))
+            {
+                add_generic_modules(*nested, modules);
+            }
+            else
+            {
+                modules.insert(get_swift_module(param->swift_logical_namespace()));
+            }
+        }
+    }
+
+    // With -shared-generics, an instantiation used by several modules is written once into the module owning it:
+    // the one module its type arguments come from, or the support module when all of them come from there or are
+    // fundamental types. Every module using it imports that one already. Instantiations mixing the types of
+    // several modules have no such module, so are still written into each module using them.
+    static auto assign_generic_owners(metadata_cache const& mdCache,
+        std::map<std::string, std::vector<std::string_view>> const& module_map,
+        include_only_used_filter const& mf)
+    {
+        // module -> the instantiations it writes for the other modules
+        std::map<std::string, std::map<std::string_view, generic_inst const*>, std::less<>> owned_generics;
+        settings.generic_owners.clear();
+        for (auto&& [module, _] : module_map)
+        {
+            owned_generics[module];
+        }
+
+        // the instantiations a module owns can refer to ones the support module owns, so it has to be written too
+        if (!settings.shared_generics || !module_map.contains(settings.support))
+        {
+            return owned_generics;
+        }
+
+        std::map<std::string_view, std::pair<generic_inst const*, std::size_t>> generics; // name -> users
+        for (auto&& [module, namespaces] : module_map)
+        {
+            auto types = mdCache.compile_namespaces(namespaces, mf);
+            for (auto&& [name, inst] : types.generic_instantiations)
+            {
+                ++generics.try_emplace(name, &inst.get(), 0).first->second.second;
+            }
+        }
+
+        for (auto&& [name, usage] : generics)
+        {
+            auto [inst, users] = usage;
+            std::set<std::string_view> modules;
+            add_generic_modules(*inst, modules);
+            modules.erase("");
+            modules.erase(settings.support);
+
+            auto owner = modules.empty() ? std::string_view{ settings.support } : *modules.begin();
+            if (users > 1 && modules.size() <= 1 && module_map.contains(std::string{ owner }))
+            {
+                settings.generic_owners.emplace(name, owner);
+                owned_generics.find(owner)->second.emplace(name, inst);
+            }
+        }
+
+        return owned_generics;
+    }
+
+    using file_stamp = std::pair<std::uintmax_t, std::filesystem::file_time_type>;
+
+    static auto get_file_stamps(std::vector<std::string> const& files)
+    {
+        std::vector<file_stamp> stamps;
+        stamps.reserve(files.size());
+        for (auto&& file : files)
+        {
+            stamps.emplace_back(std::filesystem::file_size(file), std::filesystem::last_write_time(file));
+        }
+        return stamps;
+    }
+
+    // The metadata loaded for a set of winmd files. -serve keeps this alive between requests and only
+    // reloads it when the set of files, or the size or modification time of one of them, changes.
+    struct loaded_metadata
+    {
+        std::vector<std::string> files;
+        std::vector<file_stamp> stamps;
+        std::unique_ptr<cache> c;
+        std::unique_ptr<metadata_cache> mdCache;
+
+        void load(std::vector<std::string> const& files_to_cache)
+        {
+            auto current = get_file_stamps(files_to_cache);
+            if (c && files == files_to_cache && stamps == current)
+            {
+                return;
+            }
+
+            static profile_counter metadata_load{ "metadata load" };
+            profile_scope timer{ metadata_load };
+            metadata_load.add();
+
+            // requests are handled one at a time, so nothing refers to the metadata being replaced anymore.
+            // The metadata_cache refers to the cache, so it goes first.
+            mdCache.reset();
+            c.reset();
+
+            files = files_to_cache;
+            stamps = std::move(current);
+            c = std::make_unique<cache>(files, [](TypeDef const& type) {
+                if (!type.Flags().WindowsRuntime())
+                {
+                    return false;
+                }
+                return true;
+            });
+            mdCache = std::make_unique<metadata_cache>(*c);
+        }
+    };
+
+    static void write_profile(writer& w)
+    {
+        w.write(" profile:\n");
+        for (auto counter : profile_counter::all())
+        {
+            w.write_printf("  %-32s%12llu%12.3fms\n",
+                std::string{ counter->name() }.c_str(),
+                static_cast<unsigned long long>(counter->count()),
+                std::chrono::duration<double, std::milli>(counter->elapsed()).count());
+        }
+
+        auto allocations = allocation_count.load();
+        w.write_printf("  %-32s%12llu\n", "heap allocations", static_cast<unsigned long long>(allocations));
+        if (auto types = types_written.count())
+        {
+            w.write_printf("  %-32s%12.1f\n", "heap allocations per type", static_cast<double>(allocations) / types);
+        }
+    }
+
+    static int run(int const argc, char** argv, loaded_metadata& metadata, std::string* output = nullptr);
+
+    [[noreturn]] static void serve(std::string const& name)
+    {
+        loaded_metadata metadata;
+        serve_requests(name, [&](generation_request const& request)
+        {
+            generation_response response;
+            try
+            {
+                std::filesystem::current_path(request.working_directory);
+            }
+            catch (std::exception const& e)
+            {
+                response.result = 1;
+                response.output = e.what();
+                return response;
+            }
+
+            std::vector<char*> argv;
+            for (auto& arg : request.args)
+            {
+                argv.push_back(const_cast<char*>(arg.c_str()));
+            }
+
+            settings = {};
+            response.result = run(static_cast<int>(argv.size()), argv.data(), metadata, &response.output);
+            return response;
+        });
+    }
+
+    static int run(int const argc, char** argv, loaded_metadata& metadata, std::string* output)
     {
         int result{};
         writer w;
@@ -211,26 +493,45 @@ Where <spec> is one or more of:
                 throw usage_exception{};
             }
 
-            process_args(args);
-            log_file = settings.output_folder / "swiftwinrt.log";
+            // -serve and -connect are ignored for requests being handled by a server
+            if (!output && args.exists("serve"))
+            {
+                serve(args.value("serve"));
+            }
 
-            cache c{ get_files_to_cache(), [](TypeDef const& type) {
-                if (!type.Flags().WindowsRuntime())
+            if (!output && args.exists("connect"))
+            {
+                generation_request request{ std::filesystem::current_path().string(), std::vector<std::string>(argv, argv + argc) };
+                if (auto response = send_request(args.value("connect"), request))
                 {
-                    return false;
+                    w.write(response->output);
+                    w.flush_to_console(response->result == 0);
+                    return response->result;
                 }
-                return true;
-            }};
-            metadata_cache mdCache{ c };
+            }
+
+            process_args(args);
+            log_file = settings.output_folder / "swiftwinrt.log";
+
+            static profile_counter generation{ "generation" };
+            profile_counter::reset_all();
+            auto profile_start = std::chrono::steady_clock::now();
+
+            metadata.load(get_files_to_cache());
+
+            // counted only from here, so that the allocations per type are the same whether or not a -serve
+            // request had to load the metadata
+            allocation_count = 0;
+            count_allocations = settings.profile;
+            auto& c = *metadata.c;
+            auto& mdCache = *metadata.mdCache;
 
             auto include = args.values("include");
             include_only_used_filter mf{ mdCache, include };
 
             if (settings.verbose)
             {
-                char* path = nullptr;
-                _get_pgmptr(&path);
-                w.write(" tool:  %\n", path);
+                w.write(" tool:  %\n", get_module_path());
                 w.write(" ver:   %\n", SWIFTWINRT_VERSION_STRING);
 
                 for (auto&& file : settings.input)
@@ -245,6 +546,11 @@ Where <spec> is one or more of:
 
                 w.write(" out:   %\n", settings.output_folder.string());
 
+                if (settings.shard_count != 0)
+                {
+                    w.write(" shard: %/%\n", settings.shard_index, settings.shard_count);
+                }
+
                 if (!settings.component_folder.empty())
                 {
                     w.write(" cout:  %\n", settings.component_folder.string());
@@ -255,7 +561,7 @@ Where <spec> is one or more of:
             {
                 w.flush_to_file(log_file);
             }
-            else
+            else if (!output)
             {
                 w.flush_to_console();
             }
@@ -265,6 +571,8 @@ Where <spec> is one or more of:
 
             std::map<std::string, std::vector<std::string_view>> module_map; // map of module -> namespaces
             std::map<std::string, std::set<std::string>> module_dependencies; // module -> module dependencies
+            std::set<std::string_view> abi_namespaces; // namespaces which get a C header
+            std::map<std::string, std::size_t> module_sizes; // module -> estimated number of types
             path output_folder = settings.output_folder;
             for (auto&&[ns, members] : c.namespaces())
             {
@@ -273,22 +581,19 @@ Where <spec> is one or more of:
                     continue;
                 }
 
-                group.add([&, &ns = ns]
+                // with -abi-filter only the reachable closure gets C definitions. Windows.Foundation is
+                // always written since every header includes it
+                if (!settings.abi_filter || ns == winrt_foundation_namespace || mf.includes_any(members))
                 {
-                    // we want the C module to contain all of the types so that incremental builds of the
-                    // projections is quick. we don't actually even need the end result of the C bindings
-                    // and so it can be discarded after the app is built - meaning the size increase doesn't
-                    // matter
-                    include_all_filter filter{c};
-                    auto types = mdCache.compile_namespaces({ ns }, filter);
-                    write_abi_header(ns, types);
-                });
+                    abi_namespaces.emplace(ns);
+                }
 
                 if (!mf.includes_any(members))
                 {
                     continue;
                 }
                 auto module_name = get_swift_module(ns);
+                module_sizes[module_name] += members.types.size();
 
                 auto [moduleMapItr, moduleAdded] = module_map.emplace(std::piecewise_construct,
                     std::forward_as_tuple(module_name),
@@ -299,8 +604,66 @@ Where <spec> is one or more of:
                 }
                 moduleMapItr->second.push_back(ns);
             }
+
+            // the same units are computed by every shard, so each can work out which ones it owns
+            std::vector<shard_unit> shard_units;
+            for (auto ns : abi_namespaces)
+            {
+                shard_units.push_back({ shard_unit_name("abi", ns), c.namespaces().at(ns).types.size() });
+            }
+            for (auto&& [module, size] : module_sizes)
+            {
+                // each type in a module is written as Swift types, ABI and implementation
+                shard_units.push_back({ shard_unit_name("module", module), size * 3 });
+            }
+            shard_plan plan{ shard_units, settings.shard_index, settings.shard_count };
+            if (settings.merge)
+            {
+                verify_shard_manifests(output_folder, shard_units, get_shard_fingerprint());
+            }
+            auto owns = [&](std::string_view kind, std::string_view name)
+            {
+                return !settings.merge && plan.owns(shard_unit_name(kind, name));
+            };
+
+            auto owned_generics = assign_generic_owners(mdCache, module_map, mf);
+
+            for (auto ns : abi_namespaces)
+            {
+                if (!owns("abi", ns))
+                {
+                    continue;
+                }
+
+                group.add([&, ns]
+                {
+                    if (settings.abi_filter)
+                    {
+                        // the forward declaration header written below covers every type so that the
+                        // reachable set growing doesn't change it
+                        auto types = mdCache.compile_namespaces({ ns }, mf);
+                        write_abi_header(ns, types);
+                    }
+                    else
+                    {
+                        // we want the C module to contain all of the types so that incremental builds of the
+                        // projections is quick. we don't actually even need the end result of the C bindings
+                        // and so it can be discarded after the app is built - meaning the size increase doesn't
+                        // matter
+                        include_all_filter filter{c};
+                        auto types = mdCache.compile_namespaces({ ns }, filter);
+                        write_abi_header(ns, types);
+                    }
+                });
+            }
+
             for (auto&& [module, namespaces] : module_map)
             {
+                if (!owns("module", module))
+                {
+                    continue;
+                }
+
                 auto [moduleItr, added] = module_dependencies.emplace(std::piecewise_construct,
                     std::forward_as_tuple(module),
                     std::forward_as_tuple());
@@ -308,7 +671,8 @@ Where <spec> is one or more of:
                 group.add([&,
                         &module = module,
                         &namespaces = namespaces,
-                        &moduleDependencies = moduleItr->second]
+                        &moduleDependencies = moduleItr->second,
+                        &ownedGenerics = owned_generics.at(module)]
                     {
                         swiftwinrt::task_group module_group;
                         module_group.add([&, &namespaces = namespaces]
@@ -316,7 +680,8 @@ Where <spec> is one or more of:
                             // generics are written on a per module basis because this helps us reduce the
                             // amount of code that is generated.
                             auto types = mdCache.compile_namespaces(namespaces, mf);
-                            write_module_generics(module, types, mf);
+                            write_module_generics(module, types, mf, ownedGenerics);
+                            write_module_makers(module, types, mf);
                         });
 
                         if (module == settings.support)
@@ -358,16 +723,53 @@ Where <spec> is one or more of:
                     });
             }
 
-            group.add([] { write_cwinrt_build_files(); });
+            if (plan.sharded())
+            {
+                // the outputs shared by the whole projection are written by -merge
+                group.get();
+                plan.write_manifest(output_folder, get_shard_fingerprint());
+            }
+            else
+            {
+                group.add([] { write_cwinrt_build_files(); });
 
-            group.get();
+                if (settings.abi_filter)
+                {
+                    group.add([&] { write_abi_forward_header(mdCache); });
+                }
 
-            write_include_all(c.namespaces());
-            write_modulemap();
+                if (settings.abi_shared_generics)
+                {
+                    group.add([&]
+                    {
+                        if (settings.abi_filter)
+                        {
+                            write_abi_generics_header(mdCache, abi_namespaces, mf);
+                        }
+                        else
+                        {
+                            include_all_filter filter{ c };
+                            write_abi_generics_header(mdCache, abi_namespaces, filter);
+                        }
+                    });
+                }
+
+                group.get();
+
+                write_include_all(abi_namespaces);
+                write_modulemap();
+            }
             if (settings.verbose)
             {
                 //w.write(" time:  %ms\n", get_elapsed_time(start));
             }
+            if (settings.profile)
+            {
+                count_allocations = false;
+                generation.add();
+                generation.add_time(std::chrono::steady_clock::now() - profile_start);
+                write_profile(w);
+            }
         }
         catch (usage_exception const&)
         {
@@ -389,6 +791,10 @@ Where <spec> is one or more of:
         {
             w.flush_to_file(log_file, true);
         }
+        else if (output)
+        {
+            *output = w.flush_to_string();
+        }
         else
         {
             w.flush_to_console(result == 0);
@@ -399,5 +805,6 @@ Where <spec> is one or more of:
 
 int main(int const argc, char** argv)
 {
-    return swiftwinrt::run(argc, argv);
+    swiftwinrt::loaded_metadata metadata;
+    return swiftwinrt::run(argc, argv, metadata);
 }
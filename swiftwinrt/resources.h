@@ -37,12 +37,16 @@
 #define RESOURCE_NAME_CWINRT_WEAKREFERENCE_H CWINRT_WEAKREFERENCE
 #define RESOURCE_NAME_CWINRT_WEAKREFERENCE_H_STR "CWINRT_WEAKREFERENCE"
 
+#define RESOURCE_NAME_CWINRT_REFERENCEBOX_H CWINRT_REFERENCEBOX
+#define RESOURCE_NAME_CWINRT_REFERENCEBOX_H_STR "CWINRT_REFERENCEBOX"
+
 #ifndef RC_INVOKED
 
 #include <span>
 
 namespace swiftwinrt
 {
+#ifdef _WIN32
     static std::span<const std::byte> find_resource(
         HMODULE hModule, LPCSTR type, LPCSTR name)
     {
@@ -119,6 +123,62 @@ namespace swiftwinrt
 
         return std::move(closure.resources);
     }
+
+    static std::map<std::string, std::span<const std::byte>> get_named_resources_of_type(
+        LPCSTR type, bool make_lowercase = false)
+    {
+        return get_named_resources_of_type(GetModuleHandle(NULL), type, make_lowercase);
+    }
+#else
+    // Without win32 resources, the files listed in resources.rc are embedded by the build as byte arrays
+    // (see embed_resources.cmake). Names are upper case, the same as the resource compiler makes them.
+    struct embedded_resource
+    {
+        char const* type;
+        char const* name;
+        std::span<const std::byte> data;
+    };
+
+    extern std::span<const embedded_resource> const embedded_resources;
+
+    static std::span<const std::byte> find_resource(char const* type, char const* name)
+    {
+        for (auto&& resource : embedded_resources)
+        {
+            if (std::string_view{ resource.type } == type && std::string_view{ resource.name } == name)
+            {
+                return resource.data;
+            }
+        }
+
+        assert(!"Resource lookup failure.");
+        return {};
+    }
+
+    static std::map<std::string, std::span<const std::byte>> get_named_resources_of_type(
+        char const* type, bool make_lowercase = false)
+    {
+        std::map<std::string, std::span<const std::byte>> resources;
+        for (auto&& resource : embedded_resources)
+        {
+            if (std::string_view{ resource.type } != type)
+            {
+                continue;
+            }
+
+            std::string res_name{ resource.name };
+            if (make_lowercase)
+            {
+                std::transform(res_name.begin(), res_name.end(), res_name.begin(),
+                    [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            }
+
+            resources.emplace(std::move(res_name), resource.data);
+        }
+
+        return resources;
+    }
+#endif
 }
 
 #endif
@@ -42,7 +42,7 @@ namespace swiftwinrt
         return default_interface->cpp_abi_name();
     }
 
-    void class_type::append_signature(sha1& hash) const
+    void class_type::append_signature(std::string& signature) const
     {
         using namespace std::literals;
         if (!default_interface)
@@ -51,11 +51,11 @@ namespace swiftwinrt
                 "does not have a signature");
         }
 
-        hash.append("rc("sv);
-        hash.append(m_swift_full_name);
-        hash.append(";"sv);
-        default_interface->append_signature(hash);
-        hash.append(")"sv);
+        signature.append("rc("sv);
+        signature.append(m_swift_full_name);
+        signature.append(";"sv);
+        signature.append(default_interface->signature());
+        signature.append(")"sv);
     }
 
     void class_type::write_c_forward_declaration(writer& w) const
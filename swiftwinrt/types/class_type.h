@@ -20,7 +20,7 @@ namespace swiftwinrt
 
         std::string_view swift_abi_namespace() const override;
         std::string_view cpp_abi_name() const override;
-        void append_signature(sha1& hash) const override;
+        void append_signature(std::string& signature) const override;
         void write_c_forward_declaration(writer& w) const override;
         void write_c_abi_param(writer& w) const override;
         void write_c_definition(writer&) const {}
@@ -22,12 +22,12 @@ namespace swiftwinrt
         m_abi_name += type.TypeName();
     }
 
-    void delegate_type::append_signature(sha1& hash) const
+    void delegate_type::append_signature(std::string& signature) const
     {
-        hash.append("delegate({"sv);
+        signature.append("delegate({"sv);
         auto iid = type_iid(m_type);
-        hash.append(std::string_view{ iid.data(), iid.size() - 1 });
-        hash.append("})"sv);
+        signature.append(std::string_view{ iid.data(), iid.size() - 1 });
+        signature.append("})"sv);
     }
 
     void delegate_type::write_c_forward_declaration(writer& w) const
@@ -17,7 +17,7 @@ namespace swiftwinrt
             return m_abi_name;
         }
 
-        void append_signature(sha1& hash) const override;
+        void append_signature(std::string& signature) const override;
         void write_c_forward_declaration(writer& w) const override;
         void write_c_abi_param(writer& w) const override;
         void write_c_definition(writer& w) const;
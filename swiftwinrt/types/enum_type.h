@@ -12,14 +12,14 @@ namespace swiftwinrt
         {
         }
 
-        void append_signature(sha1& hash) const override
+        void append_signature(std::string& signature) const override
         {
             using namespace std::literals;
-            hash.append("enum("sv);
-            hash.append(m_swift_full_name);
-            hash.append(";"sv);
-            element_type::from_type(underlying_type()).append_signature(hash);
-            hash.append(")"sv);
+            signature.append("enum("sv);
+            signature.append(m_swift_full_name);
+            signature.append(";"sv);
+            signature.append(element_type::from_type(underlying_type()).signature());
+            signature.append(")"sv);
         }
 
         void write_c_forward_declaration(writer& w) const override;
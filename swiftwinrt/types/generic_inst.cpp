@@ -6,6 +6,8 @@
 #include "code_writers/common_writers.h"
 #include "code_writers/writer_helpers.h"
 #include "utility/metadata_helpers.h"
+#include "utility/profiling.h"
+#include "utility/sha1.h"
 #include "types/class_type.h"
 #include "types/delegate_type.h"
 #include "types/interface_type.h"
@@ -60,18 +62,48 @@ namespace swiftwinrt
         return false;
     }
 
-    void generic_inst::append_signature(sha1& hash) const
+    void generic_inst::append_signature(std::string& signature) const
     {
-        hash.append("pinterface({"sv);
+        signature.append("pinterface({"sv);
         auto iid = type_iid(m_generic_type->type());
-        hash.append(std::string_view{ iid.data(), iid.size() - 1 });
-        hash.append("}"sv);
+        signature.append(std::string_view{ iid.data(), iid.size() - 1 });
+        signature.append("}"sv);
         for (auto param : m_generic_params)
         {
-            hash.append(";"sv);
-            param->append_signature(hash);
+            signature.append(";"sv);
+            signature.append(param->signature());
         }
-        hash.append(")"sv);
+        signature.append(")"sv);
+    }
+
+    std::array<std::uint8_t, 20> const& generic_inst::iid_hash() const
+    {
+        static profile_counter computed{ "generic iids computed" };
+        static profile_counter hashed{ "generic iid bytes hashed" };
+
+        if (!m_iid_hash)
+        {
+            profile_scope timer{ computed };
+            static constexpr std::uint8_t namespaceGuidBytes[] =
+            {
+                0x11, 0xf4, 0x7a, 0xd5,
+                0x7b, 0x73,
+                0x42, 0xc0,
+                0xab, 0xae, 0x87, 0x8b, 0x1e, 0x16, 0xad, 0xee
+            };
+            auto signature = this->signature();
+            computed.add();
+            hashed.add(std::size(namespaceGuidBytes) + signature.size());
+
+            sha1 signatureHash;
+            signatureHash.append(namespaceGuidBytes, std::size(namespaceGuidBytes));
+            signatureHash.append(signature);
+            auto iidHash = signatureHash.finalize();
+            iidHash[6] = (iidHash[6] & 0x0F) | 0x50;
+            iidHash[8] = (iidHash[8] & 0x3F) | 0x80;
+            m_iid_hash = iidHash;
+        }
+        return *m_iid_hash;
     }
 
     void generic_inst::write_c_forward_declaration(writer& w) const
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -57,7 +59,7 @@ namespace swiftwinrt
             return m_mangled_name;
         }
 
-        void append_signature(sha1& hash) const override;
+        void append_signature(std::string& signature) const override;
         void write_c_forward_declaration(writer& w) const override;
         void write_c_abi_param(writer& w) const override;
         bool is_experimental() const override;
@@ -79,6 +81,10 @@ namespace swiftwinrt
 
         std::string_view generic_type_abi_name() const noexcept;
 
+        // The IID derived from the signature of this instantiation, as the 20 byte hash it's taken from.
+        // Memoized alongside the signature.
+        std::array<std::uint8_t, 20> const& iid_hash() const;
+
         std::vector<metadata_type const*> const& generic_params() const noexcept
         {
             return m_generic_params;
@@ -96,5 +102,6 @@ namespace swiftwinrt
         std::string m_swift_full_name;
         std::string m_swift_type_name;
         std::string m_mangled_name;
+        mutable std::optional<std::array<std::uint8_t, 20>> m_iid_hash;
     };
 }
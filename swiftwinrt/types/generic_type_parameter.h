@@ -53,7 +53,7 @@ namespace swiftwinrt
             return m_param_name;
         }
 
-        void append_signature(sha1&) const override
+        void append_signature(std::string&) const override
         {
         }
 
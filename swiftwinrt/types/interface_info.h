@@ -19,6 +19,8 @@ namespace swiftwinrt
         bool attributed{};
         std::pair<uint32_t, uint32_t> relative_version{};
         generic_param_vector generic_params{};
+        // The row through which the interface was found, on the class for the interfaces it implements directly
+        winmd::reader::InterfaceImpl impl{};
     };
 
     using named_interface_info = std::pair<std::string, interface_info>;
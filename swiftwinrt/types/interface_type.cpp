@@ -13,12 +13,12 @@ using namespace std::literals;
 
 namespace swiftwinrt
 {
-    void interface_type::append_signature(sha1& hash) const
+    void interface_type::append_signature(std::string& signature) const
     {
-        hash.append("{"sv);
+        signature.append("{"sv);
         auto iid = type_iid(m_type);
-        hash.append(std::string_view{ iid.data(), iid.size() - 1 });
-        hash.append("}"sv);
+        signature.append(std::string_view{ iid.data(), iid.size() - 1 });
+        signature.append("}"sv);
     }
 
     void interface_type::write_c_forward_declaration(writer& w) const
@@ -25,33 +25,29 @@ namespace swiftwinrt
     {
     }
 
-    mapped_type const* mapped_type::from_typedef(TypeDef const& type)
+    std::optional<mapped_type> mapped_type::from_typedef(TypeDef const& type)
     {
         if (type.TypeNamespace() == winrt_foundation_namespace)
         {
             if (type.TypeName() == "HResult"sv)
             {
-                static mapped_type const hresult_type{ type, "HRESULT"sv, "HRESULT"sv, "struct(Windows.Foundation.HResult;i4)"sv };
-                return &hresult_type;
+                return mapped_type{ type, "HRESULT"sv, "HRESULT"sv, "struct(Windows.Foundation.HResult;i4)"sv };
             }
             else if (type.TypeName() == "EventRegistrationToken"sv)
             {
-                static mapped_type event_token_type{ type, "EventRegistrationToken"sv, "EventRegistrationToken"sv, "struct(Windows.Foundation.EventRegistrationToken;i8)"sv };
-                return &event_token_type;
+                return mapped_type{ type, "EventRegistrationToken"sv, "EventRegistrationToken"sv, "struct(Windows.Foundation.EventRegistrationToken;i8)"sv };
             }
             else if (type.TypeName() == "AsyncStatus"sv)
             {
-                static mapped_type const async_status_type{ type, "AsyncStatus"sv, "AsyncStatus"sv, "enum(Windows.Foundation.AsyncStatus;i4)"sv };
-                return &async_status_type;
+                return mapped_type{ type, "AsyncStatus"sv, "AsyncStatus"sv, "enum(Windows.Foundation.AsyncStatus;i4)"sv };
             }
             else if (type.TypeName() == "IAsyncInfo"sv)
             {
-                static mapped_type const async_info_type{ type, "IAsyncInfo"sv, "IAsyncInfo"sv, "{00000036-0000-0000-c000-000000000046}"sv };
-                return &async_info_type;
+                return mapped_type{ type, "IAsyncInfo"sv, "IAsyncInfo"sv, "{00000036-0000-0000-c000-000000000046}"sv };
             }
         }
 
-        return nullptr;
+        return std::nullopt;
     }
 
     void mapped_type::write_c_abi_param(writer& w) const
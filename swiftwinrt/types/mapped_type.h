@@ -15,7 +15,9 @@ namespace swiftwinrt
             std::string_view mangled_name,
             std::string_view signature);
 
-        static mapped_type const* from_typedef(winmd::reader::TypeDef const& type);
+        // The projection of the type if it's one which is mapped to a C type rather than projected as is, made from
+        // the given TypeDef so that it belongs to the same metadata
+        static std::optional<mapped_type> from_typedef(winmd::reader::TypeDef const& type);
 
         std::string_view swift_abi_namespace() const override
         {
@@ -57,9 +59,9 @@ namespace swiftwinrt
             return m_mangled_name;
         }
 
-        void append_signature(sha1& hash) const override
+        void append_signature(std::string& signature) const override
         {
-            hash.append(m_signature);
+            signature.append(m_signature);
         }
 
         void write_c_forward_declaration(writer&) const override
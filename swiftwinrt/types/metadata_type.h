@@ -6,7 +6,6 @@
 #include <string_view>
 #include <vector>
 
-#include "utility/sha1.h"
 #include "utility/versioning.h"
 #include "winmd_reader.h"
 
@@ -39,7 +38,20 @@ namespace swiftwinrt
         virtual std::string_view mangled_name() const = 0;
         virtual std::string_view generic_param_mangled_name() const = 0;
 
-        virtual void append_signature(sha1& hash) const = 0;
+        // Appends the WinRT type signature from which the IIDs of generic instantiations are derived. Nested
+        // types should be appended through signature() so that their signatures are only built once.
+        virtual void append_signature(std::string& signature) const = 0;
+
+        // The memoized type signature. Types are shared between namespaces and the writers run in parallel, so
+        // the metadata_cache computes every signature that generic IIDs depend on up front.
+        std::string_view signature() const
+        {
+            if (m_signature.empty())
+            {
+                append_signature(m_signature);
+            }
+            return m_signature;
+        }
 
         virtual void write_c_forward_declaration(writer& w) const = 0;
         virtual void write_c_abi_param(writer& w) const = 0;
@@ -55,6 +67,9 @@ namespace swiftwinrt
         {
             return std::nullopt;
         }
+
+    private:
+        mutable std::string m_signature;
     };
 
     inline bool operator<(metadata_type const& lhs, metadata_type const& rhs) noexcept
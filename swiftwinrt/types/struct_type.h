@@ -14,18 +14,18 @@ namespace swiftwinrt
         {
         }
 
-        void append_signature(sha1& hash) const override
+        void append_signature(std::string& signature) const override
         {
             using namespace std::literals;
             XLANG_ASSERT(members.size() == static_cast<std::size_t>(distance(m_type.FieldList())));
-            hash.append("struct("sv);
-            hash.append(m_swift_full_name);
+            signature.append("struct("sv);
+            signature.append(m_swift_full_name);
             for (auto const& member : members)
             {
-                hash.append(";");
-                member.type->append_signature(hash);
+                signature.append(";"sv);
+                signature.append(member.type->signature());
             }
-            hash.append(")"sv);
+            signature.append(")"sv);
         }
 
         void write_c_forward_declaration(writer& w) const override;
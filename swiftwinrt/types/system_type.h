@@ -59,9 +59,9 @@ namespace swiftwinrt
             return m_cpp_name;
         }
 
-        void append_signature(sha1& hash) const override
+        void append_signature(std::string& signature) const override
         {
-            hash.append(m_signature);
+            signature.append(m_signature);
         }
 
         void write_c_forward_declaration(writer&) const override
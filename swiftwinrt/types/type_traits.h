@@ -153,7 +153,7 @@ namespace swiftwinrt
         if (type.swift_logical_namespace() == winrt_foundation_namespace)
         {
             auto name = type.swift_type_name();
-            return name == "IAsyncAction" || name.starts_with("IAsyncOperation");
+            return name == "IAsyncAction" || name.starts_with("IAsyncActionWithProgress") || name.starts_with("IAsyncOperation");
         }
 
         return false;
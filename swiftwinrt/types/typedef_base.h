@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -74,6 +76,24 @@ namespace swiftwinrt
 
         std::vector<generic_type_parameter> generic_params;
 
+        // The last include_only_used_filter decision made for this type, tagged with the id of the filter which
+        // made it. Filters are shared by the writers, which run in parallel, so the tag and the decision are
+        // packed into one word that is read and written atomically.
+        std::optional<bool> filter_decision(std::uint64_t filter_id) const noexcept
+        {
+            auto decision = std::atomic_ref<std::uint64_t>(m_filter_decision).load(std::memory_order_relaxed);
+            if ((decision >> 1) != filter_id)
+            {
+                return std::nullopt;
+            }
+            return (decision & 1) != 0;
+        }
+
+        void set_filter_decision(std::uint64_t filter_id, bool included) const noexcept
+        {
+            std::atomic_ref<std::uint64_t>(m_filter_decision).store((filter_id << 1) | (included ? 1 : 0), std::memory_order_relaxed);
+        }
+
     protected:
         winmd::reader::TypeDef m_type;
         std::string m_swift_full_name;
@@ -81,5 +101,8 @@ namespace swiftwinrt
         std::string m_generic_param_mangled_name;
         std::vector<platform_version> m_platform_versions;
         std::optional<contract_history> m_contract_history;
+
+    private:
+        alignas(std::atomic_ref<std::uint64_t>::required_alignment) mutable std::uint64_t m_filter_decision{};
     };
 }
@@ -3,7 +3,11 @@
 #include <cassert>
 #include <array>
 #include <limits>
+#include <climits>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
 #include <string>
 #include <string_view>
 #include <map>
@@ -12,12 +16,23 @@
 #include <filesystem>
 #include <fstream>
 #include <regex>
+#ifdef _WIN32
 #include <Windows.h>
 #include <shlwapi.h>
 #include <XmlLite.h>
+#elif defined(__APPLE__)
+#include <mach-o/dyld.h>
+#endif
 
 namespace swiftwinrt
 {
+    enum class xml_requirement
+    {
+        required = 0,
+        optional
+    };
+
+#ifdef _WIN32
     struct registry_key
     {
         HKEY handle{};
@@ -71,12 +86,6 @@ namespace swiftwinrt
         }
     }
 
-    enum class xml_requirement
-    {
-        required = 0,
-        optional
-    };
-
     inline void add_files_from_xml(
         std::set<std::string>& files,
         std::string const& sdk_version,
@@ -292,6 +301,120 @@ namespace swiftwinrt
 
         return result;
     }
+#else
+    // Without XmlLite the Platform.xml is scanned for its ApiContract elements, which are the only part of it
+    // that is needed, rather than being fully parsed.
+    inline void add_files_from_xml(
+        std::set<std::string>& files,
+        std::string const& sdk_version,
+        std::filesystem::path const& xml_path,
+        std::filesystem::path const& sdk_path,
+        xml_requirement xml_path_requirement)
+    {
+        std::ifstream stream(xml_path, std::ios::binary);
+        if (!stream)
+        {
+            if (xml_path_requirement == xml_requirement::optional)
+            {
+                return;
+            }
+
+            throw std::invalid_argument("Could not read the Windows SDK's Platform.xml");
+        }
+
+        std::string xml{ std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>() };
+        std::regex element_rx(R"(<\s*ApiContract\s([^>]*)>)");
+        std::regex name_rx(R"^-^((?:^|\s)name\s*=\s*"([^"]*)")^-^");
+        std::regex version_rx(R"^-^((?:^|\s)version\s*=\s*"([^"]*)")^-^");
+
+        for (auto itr = std::sregex_iterator(xml.begin(), xml.end(), element_rx); itr != std::sregex_iterator(); ++itr)
+        {
+            auto attributes = (*itr)[1].str();
+            std::smatch name;
+            std::smatch version;
+            if (!std::regex_search(attributes, name, name_rx) || !std::regex_search(attributes, version, version_rx))
+            {
+                throw std::invalid_argument("Could not read the Windows SDK's Platform.xml");
+            }
+
+            auto path = sdk_path;
+            path /= "References";
+            path /= sdk_version;
+            path /= name[1].str();
+            path /= version[1].str();
+            path /= name[1].str();
+            path += ".winmd";
+            files.insert(path.string());
+        }
+    }
+
+    // There is no registry to find the SDK with, so it is taken from the WindowsSdkDir environment variable
+    // (as set by the Visual Studio developer prompt) pointing at the root of a copy of the SDK.
+    inline std::filesystem::path get_sdk_path()
+    {
+        auto root = std::getenv("WindowsSdkDir");
+        if (!root || !*root)
+        {
+            throw std::invalid_argument("Could not find the Windows SDK, set WindowsSdkDir to the root of the SDK");
+        }
+
+        return root;
+    }
+
+    inline std::string get_module_path()
+    {
+#ifdef __APPLE__
+        // there is no /proc on macOS, the path is asked for twice when the first buffer is too small
+        std::string path(PATH_MAX, '\0');
+        auto size = static_cast<uint32_t>(path.size());
+        if (_NSGetExecutablePath(path.data(), &size) != 0)
+        {
+            path.resize(size);
+            _NSGetExecutablePath(path.data(), &size);
+        }
+        path.resize(std::strlen(path.c_str()));
+        return std::filesystem::canonical(path).string();
+#else
+        return std::filesystem::read_symlink("/proc/self/exe").string();
+#endif
+    }
+
+    inline std::string get_sdk_version()
+    {
+        std::regex rx(R"((\d+)\.(\d+)\.(\d+)\.(\d+))");
+        std::array<unsigned long, 4> newest{};
+        std::string result;
+
+        for (auto&& item : std::filesystem::directory_iterator(get_sdk_path() / "Platforms" / "UAP"))
+        {
+            auto name = item.path().filename().string();
+            std::smatch match;
+            if (!std::regex_match(name, match, rx) || !std::filesystem::exists(item.path() / "Platform.xml"))
+            {
+                continue;
+            }
+
+            std::array<unsigned long, 4> version_parts{};
+            for (size_t i = 0; i < version_parts.size(); ++i)
+            {
+                version_parts[i] = std::stoul(match[i + 1].str());
+            }
+
+            if (result.empty() || version_parts > newest)
+            {
+                newest = version_parts;
+                result = name;
+            }
+        }
+
+        if (result.empty())
+        {
+            throw std::invalid_argument("Could not find the Windows SDK");
+        }
+
+        return result;
+    }
+#endif
 
     [[noreturn]] inline void throw_invalid(std::string const& message)
     {
@@ -441,6 +564,7 @@ namespace swiftwinrt
                 }
                 if (path == "local")
                 {
+#ifdef _WIN32
                     std::array<char, 260> local{};
 #ifdef _WIN64
                     ExpandEnvironmentStringsA("%windir%\\System32\\WinMetadata", local.data(), static_cast<uint32_t>(local.size()));
@@ -449,6 +573,9 @@ namespace swiftwinrt
 #endif
                     add_directory(local.data());
                     continue;
+#else
+                    throw_invalid("Path 'local' is only available on Windows");
+#endif
                 }
 
                 std::string sdk_version;
@@ -472,7 +599,8 @@ namespace swiftwinrt
                 {
                     auto sdk_path = get_sdk_path();
                     auto xml_path = sdk_path;
-                    xml_path /= L"Platforms\\UAP";
+                    xml_path /= L"Platforms";
+                    xml_path /= L"UAP";
                     xml_path /= sdk_version;
                     xml_path /= L"Platform.xml";
 
@@ -0,0 +1,379 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace swiftwinrt
+{
+    // A generation request sent by `-connect` to a `-serve` process: the client's working directory
+    // followed by its command line arguments
+    struct generation_request
+    {
+        std::string working_directory;
+        std::vector<std::string> args;
+    };
+
+    struct generation_response
+    {
+        int result{};
+        std::string output;
+    };
+
+#ifdef _WIN32
+    using native_pipe = HANDLE;
+    inline const native_pipe invalid_pipe = INVALID_HANDLE_VALUE;
+#else
+    using native_pipe = int;
+    inline constexpr native_pipe invalid_pipe = -1;
+#endif
+
+    struct pipe_handle
+    {
+        native_pipe handle{ invalid_pipe };
+
+        pipe_handle(pipe_handle const&) = delete;
+        pipe_handle& operator=(pipe_handle const&) = delete;
+
+        explicit pipe_handle(native_pipe handle) :
+            handle(handle)
+        {
+        }
+
+        pipe_handle(pipe_handle&& other) noexcept :
+            handle(std::exchange(other.handle, invalid_pipe))
+        {
+        }
+
+        pipe_handle& operator=(pipe_handle&& other) noexcept
+        {
+            std::swap(handle, other.handle);
+            return *this;
+        }
+
+        ~pipe_handle() noexcept
+        {
+            if (handle != invalid_pipe)
+            {
+#ifdef _WIN32
+                CloseHandle(handle);
+#else
+                close(handle);
+#endif
+            }
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return handle != invalid_pipe;
+        }
+    };
+
+#ifndef _WIN32
+    // Sockets are kept in a directory which only the current user can get into, so that another user can neither
+    // send requests to this user's server nor put a server of their own in place of it. That's XDG_RUNTIME_DIR when
+    // the session has one, and otherwise a directory per user in the temp folder.
+    inline std::filesystem::path get_socket_directory()
+    {
+        if (auto runtime_directory = std::getenv("XDG_RUNTIME_DIR"); runtime_directory && *runtime_directory)
+        {
+            return runtime_directory;
+        }
+        return std::filesystem::temp_directory_path() / ("swiftwinrt-" + std::to_string(getuid()));
+    }
+
+    // Whether the directory belongs to the current user and no one else has access to it. lstat so that a symlink
+    // to some other directory doesn't pass.
+    inline bool is_private_directory(std::filesystem::path const& directory)
+    {
+        struct stat status{};
+        return lstat(directory.c_str(), &status) == 0 &&
+            S_ISDIR(status.st_mode) &&
+            status.st_uid == getuid() &&
+            (status.st_mode & (S_IRWXG | S_IRWXO)) == 0;
+    }
+
+    // Writing to a socket whose peer went away raises SIGPIPE, which would take the server down. Linux turns that off
+    // for each send with MSG_NOSIGNAL, Apple platforms don't have it and turn it off for the socket with SO_NOSIGPIPE.
+#ifdef MSG_NOSIGNAL
+    constexpr int send_flags = MSG_NOSIGNAL;
+#else
+    constexpr int send_flags = 0;
+#endif
+
+    inline void suppress_sigpipe([[maybe_unused]] int socket) noexcept
+    {
+#ifdef SO_NOSIGPIPE
+        int on = 1;
+        setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+    }
+#endif
+
+    // A named pipe on Windows, a unix domain socket in a private directory elsewhere
+    inline std::string get_pipe_name(std::string_view name)
+    {
+#ifdef _WIN32
+        std::string result{ R"(\\.\pipe\swiftwinrt-)" };
+        result += name;
+        return result;
+#else
+        std::string filename{ "swiftwinrt-" };
+        filename += name;
+        filename += ".sock";
+        return (get_socket_directory() / filename).string();
+#endif
+    }
+
+    inline void write_pipe(native_pipe pipe, void const* data, uint32_t size)
+    {
+        auto bytes = static_cast<char const*>(data);
+        while (size != 0)
+        {
+#ifdef _WIN32
+            DWORD written{};
+            if (!WriteFile(pipe, bytes, size, &written, nullptr))
+#else
+            auto written = send(pipe, bytes, size, send_flags);
+            if (written <= 0)
+#endif
+            {
+                throw_invalid("Failed to write to the generator pipe");
+            }
+            bytes += written;
+            size -= static_cast<uint32_t>(written);
+        }
+    }
+
+    inline bool read_pipe(native_pipe pipe, void* data, uint32_t size)
+    {
+        auto bytes = static_cast<char*>(data);
+        while (size != 0)
+        {
+#ifdef _WIN32
+            DWORD read{};
+            if (!ReadFile(pipe, bytes, size, &read, nullptr) || read == 0)
+#else
+            auto read = ::read(pipe, bytes, size);
+            if (read <= 0)
+#endif
+            {
+                return false;
+            }
+            bytes += read;
+            size -= static_cast<uint32_t>(read);
+        }
+        return true;
+    }
+
+    // Messages are a count followed by that many length prefixed strings. The counts and lengths come from the
+    // other end of the pipe, so they're checked against these before anything is allocated for them.
+    inline constexpr uint32_t max_message_parts = 64 * 1024;
+    inline constexpr uint32_t max_message_part_size = 64 * 1024 * 1024;
+
+    inline void write_message(native_pipe pipe, std::vector<std::string> const& parts)
+    {
+        auto count = static_cast<uint32_t>(parts.size());
+        write_pipe(pipe, &count, sizeof(count));
+        for (auto& part : parts)
+        {
+            auto size = static_cast<uint32_t>(part.size());
+            write_pipe(pipe, &size, sizeof(size));
+            write_pipe(pipe, part.data(), size);
+        }
+    }
+
+    inline std::optional<std::vector<std::string>> read_message(native_pipe pipe)
+    {
+        uint32_t count{};
+        if (!read_pipe(pipe, &count, sizeof(count)) || count > max_message_parts)
+        {
+            return {};
+        }
+
+        std::vector<std::string> parts(count);
+        for (auto& part : parts)
+        {
+            uint32_t size{};
+            if (!read_pipe(pipe, &size, sizeof(size)) || size > max_message_part_size)
+            {
+                return {};
+            }
+            part.resize(size);
+            if (!read_pipe(pipe, part.data(), size))
+            {
+                return {};
+            }
+        }
+        return parts;
+    }
+
+#ifdef _WIN32
+    inline pipe_handle create_server_pipe(std::string const& pipe_name, bool first)
+    {
+        pipe_handle pipe{ CreateNamedPipeA(
+            pipe_name.c_str(),
+            PIPE_ACCESS_DUPLEX | (first ? FILE_FLAG_FIRST_PIPE_INSTANCE : 0),
+            PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+            PIPE_UNLIMITED_INSTANCES,
+            64 * 1024,
+            64 * 1024,
+            0,
+            nullptr) };
+        if (!pipe)
+        {
+            throw_invalid("Could not create the generator pipe '", pipe_name, "', is another server already running?");
+        }
+        return pipe;
+    }
+#else
+    inline sockaddr_un get_socket_address(std::string const& pipe_name)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (pipe_name.size() >= sizeof(address.sun_path))
+        {
+            throw_invalid("The generator socket path '", pipe_name, "' is too long");
+        }
+        pipe_name.copy(address.sun_path, pipe_name.size());
+        return address;
+    }
+#endif
+
+    // Serves requests one at a time until the process is terminated. Requests are handled serially since
+    // they share the global settings and the loaded metadata.
+    template <typename F>
+    [[noreturn]] void serve_requests(std::string_view name, F&& handler)
+    {
+        auto pipe_name = get_pipe_name(name);
+#ifdef _WIN32
+        auto listening = create_server_pipe(pipe_name, true);
+#else
+        // the listening socket queues up clients which arrive while a request is being handled
+        auto directory = std::filesystem::path{ pipe_name }.parent_path();
+        mkdir(directory.c_str(), S_IRWXU);
+        if (!is_private_directory(directory))
+        {
+            throw_invalid("The generator socket directory '", directory.string(), "' must belong to the current user and be inaccessible to others");
+        }
+
+        pipe_handle listening{ socket(AF_UNIX, SOCK_STREAM, 0) };
+        auto address = get_socket_address(pipe_name);
+        std::filesystem::remove(pipe_name);
+        if (!listening ||
+            bind(listening.handle, reinterpret_cast<sockaddr const*>(&address), sizeof(address)) != 0 ||
+            listen(listening.handle, SOMAXCONN) != 0)
+        {
+            throw_invalid("Could not create the generator socket '", pipe_name, "'");
+        }
+#endif
+        while (true)
+        {
+#ifdef _WIN32
+            if (!ConnectNamedPipe(listening.handle, nullptr) && GetLastError() != ERROR_PIPE_CONNECTED)
+            {
+                listening = create_server_pipe(pipe_name, false);
+                continue;
+            }
+
+            // create the next instance straight away so that clients arriving while this request is being
+            // handled queue up on it instead of finding no server and falling back to generating themselves
+            auto pipe = std::move(listening);
+            listening = create_server_pipe(pipe_name, false);
+#else
+            pipe_handle pipe{ accept(listening.handle, nullptr, nullptr) };
+            if (!pipe)
+            {
+                continue;
+            }
+            suppress_sigpipe(pipe.handle);
+#endif
+
+            auto message = read_message(pipe.handle);
+            if (!message || message->empty())
+            {
+                continue;
+            }
+
+            generation_request request;
+            request.working_directory = std::move(message->front());
+            request.args.assign(std::make_move_iterator(message->begin() + 1), std::make_move_iterator(message->end()));
+
+            generation_response response = handler(request);
+
+            try
+            {
+                write_message(pipe.handle, { std::to_string(response.result), response.output });
+#ifdef _WIN32
+                FlushFileBuffers(pipe.handle);
+#endif
+            }
+            catch (std::invalid_argument const&)
+            {
+                // the client went away, nothing to report back to
+            }
+#ifdef _WIN32
+            DisconnectNamedPipe(pipe.handle);
+#endif
+        }
+    }
+
+    // Sends a request to a running server. Returns nothing when there is no server listening so that the
+    // caller can fall back to generating in process.
+    inline std::optional<generation_response> send_request(std::string_view name, generation_request const& request)
+    {
+        auto pipe_name = get_pipe_name(name);
+#ifdef _WIN32
+        pipe_handle pipe{ CreateFileA(pipe_name.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, 0, nullptr) };
+        while (!pipe && GetLastError() == ERROR_PIPE_BUSY && WaitNamedPipeA(pipe_name.c_str(), NMPWAIT_WAIT_FOREVER))
+        {
+            pipe = pipe_handle{ CreateFileA(pipe_name.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, OPEN_EXISTING, 0, nullptr) };
+        }
+        if (!pipe)
+        {
+            return {};
+        }
+#else
+        // a socket in a directory which others can get into may not be this user's server
+        if (!is_private_directory(std::filesystem::path{ pipe_name }.parent_path()))
+        {
+            return {};
+        }
+
+        pipe_handle pipe{ socket(AF_UNIX, SOCK_STREAM, 0) };
+        auto address = get_socket_address(pipe_name);
+        if (!pipe || connect(pipe.handle, reinterpret_cast<sockaddr const*>(&address), sizeof(address)) != 0)
+        {
+            return {};
+        }
+        suppress_sigpipe(pipe.handle);
+#endif
+
+        std::vector<std::string> parts;
+        parts.reserve(request.args.size() + 1);
+        parts.push_back(request.working_directory);
+        parts.insert(parts.end(), request.args.begin(), request.args.end());
+        write_message(pipe.handle, parts);
+
+        auto message = read_message(pipe.handle);
+        if (!message || message->size() != 2)
+        {
+            throw_invalid("The generator server at '", pipe_name, "' closed the connection");
+        }
+
+        return generation_response{ std::stoi(message->front()), std::move(message->back()) };
+    }
+}
@@ -49,6 +49,17 @@ metadata_cache::metadata_cache(winmd::reader::cache const& c)
         });
     }
     group.get();
+
+    // Signatures are memoized on the types, which are shared between namespaces, so compute the generic IIDs on
+    // this thread now rather than racing on them later from the writers. Nested instantiations live in the same
+    // namespace as the ones that use them, so this covers every signature a generic IID depends on.
+    for (auto& [ns, nsCache] : namespaces)
+    {
+        for (auto& [name, inst] : nsCache.generic_instantiations)
+        {
+            inst.iid_hash();
+        }
+    }
 }
 
 void metadata_cache::process_namespace_types(
@@ -68,14 +79,17 @@ void metadata_cache::process_namespace_types(
     }
 
     target.structs.reserve(members.structs.size());
+    // reserved up front like the other types, the table refers to them by reference
+    target.mapped_types.reserve(isFoundationNamespace ? members.structs.size() : 0);
     for (auto const& s : members.structs)
     {
         // 'EventRegistrationToken' and 'HResult' are structs
         if (isFoundationNamespace)
         {
-            if (auto ptr = mapped_type::from_typedef(s))
+            if (auto mapped = mapped_type::from_typedef(s))
             {
-                [[maybe_unused]] auto [itr, added] = table.emplace(s.TypeName(), *ptr);
+                target.mapped_types.push_back(std::move(*mapped));
+                [[maybe_unused]] auto [itr, added] = table.emplace(s.TypeName(), target.mapped_types.back());
                 XLANG_ASSERT(added);
                 continue;
             }
@@ -233,6 +247,7 @@ void metadata_cache::get_interfaces_impl(init_state& state, writer& w, get_inter
         auto type = impl.Interface();
         info.type = &find_dependent_type(state, type);
         info.is_default = has_attribute(impl, "Windows.Foundation.Metadata", "DefaultAttribute");
+        info.impl = impl;
         info.defaulted = !base && (defaulted || info.is_default);
         writer::generic_param_guard guard;
         if (auto genericInst = dynamic_cast<const generic_inst*>(info.type))
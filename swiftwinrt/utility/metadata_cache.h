@@ -76,6 +76,7 @@ namespace swiftwinrt
         std::vector<interface_type> interfaces;
         std::vector<class_type> classes;
         std::vector<api_contract> contracts;
+        std::vector<mapped_type> mapped_types;
 
         // Dependencies
         std::set<std::string_view> dependent_namespaces;
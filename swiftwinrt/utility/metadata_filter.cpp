@@ -1,4 +1,5 @@
 #include "pch.h"
+#include <atomic>
 #include <queue>
 
 #include "types.h"
@@ -9,6 +10,7 @@
 #include "metadata_filter.h"
 #include "attributes.h"
 #include "utility/metadata_helpers.h"
+#include "utility/profiling.h"
 namespace swiftwinrt
 {
     using processing_queue = std::queue<metadata_type const*>;
@@ -64,7 +66,7 @@ namespace swiftwinrt
     {
         if (type.functions.empty()) return;
 
-        auto invoke_func = type.functions[0];
+        auto& invoke_func = type.functions[0];
         if (invoke_func.return_type)
         {
             to_process.emplace(invoke_func.return_type.value().type);
@@ -214,6 +216,35 @@ namespace swiftwinrt
         return false;
     }
 
+    bool include_only_used_filter::includes(typedef_base const& type) const
+    {
+        static profile_counter lookups{ "can_write lookups" };
+        static profile_counter checks{ "can_write filter checks" };
+
+        // this is the hot path, only count it when asked to rather than have every writer thread share the counter
+        if (settings.profile)
+        {
+            lookups.add();
+        }
+
+        if (auto decision = type.filter_decision(m_id))
+        {
+            return *decision;
+        }
+
+        checks.add();
+        auto included = includes(type.type());
+        type.set_filter_decision(m_id, included);
+        return included;
+    }
+
+    std::uint64_t include_only_used_filter::next_id() noexcept
+    {
+        // ids start at 1 so that a type which hasn't been seen by any filter has no decision
+        static std::atomic<std::uint64_t> id{};
+        return ++id;
+    }
+
     // we want to make sure the cache (which contains all possible types) has **something** that is
     // projected - this ensures a simple namespace with just an API contract (i.e. Microsoft.Foundation)
     // isn't included. we won't generate a header for this type, and so we can get in a world where we
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <unordered_map>
@@ -10,6 +11,7 @@
 namespace swiftwinrt
 {
     struct metadata_cache;
+    struct typedef_base;
     struct metadata_filter
     {
         virtual bool includes(winmd::reader::TypeDef const& type) const = 0;
@@ -55,7 +57,15 @@ namespace swiftwinrt
         virtual bool includes_ns(std::string_view const& ns) const { return namespaces.find(std::string(ns)) != namespaces.end(); }
         virtual bool includes_generic(std::string_view const& generic) const { return generics.find(std::string(generic)) != generics.end(); }
 
+        // Same as includes(type.type()), but the decision is memoized on the type so that can_write doesn't
+        // repeat the lookups for types which are referenced over and over
+        bool includes(typedef_base const& type) const;
+
     private:
+        static std::uint64_t next_id() noexcept;
+
+        // Identifies the decisions made by this filter (and its copies) among those memoized on the types
+        std::uint64_t m_id{ next_id() };
         std::map<std::string_view, std::set<std::string_view>> types;
         std::set<std::string> namespaces;
         std::set<std::string> generics;
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace swiftwinrt
+{
+    // FNV-1a over UTF-16 code units, finished with the murmur3 mix since FNV alone leaves the low bits (which
+    // the table size picks out) depending only on the low bits of each unit. The Swift support code hashes
+    // names looked up at runtime the same way (see runtimeClassHash in MakeFromAbi.swift), so the two need to
+    // be kept in sync.
+    inline uint32_t utf16_hash(std::u16string_view value, uint32_t seed)
+    {
+        uint32_t hash = 2166136261u ^ seed;
+        for (auto unit : value)
+        {
+            hash = (hash ^ unit) * 16777619u;
+        }
+        hash ^= hash >> 16;
+        hash *= 0x85ebca6bu;
+        hash ^= hash >> 13;
+        hash *= 0xc2b2ae35u;
+        hash ^= hash >> 16;
+        return hash;
+    }
+
+    // Metadata names are UTF-8, the names which WinRT hands back at runtime are UTF-16
+    inline std::u16string to_utf16(std::string_view value)
+    {
+        std::u16string result;
+        result.reserve(value.size());
+        for (std::size_t i = 0; i < value.size();)
+        {
+            auto lead = static_cast<unsigned char>(value[i]);
+            auto length = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+            uint32_t code_point = length == 1 ? lead : lead & (0x3F >> (length - 1));
+            for (int j = 1; j < length && i + j < value.size(); ++j)
+            {
+                code_point = (code_point << 6) | (static_cast<unsigned char>(value[i + j]) & 0x3F);
+            }
+            i += length;
+
+            if (code_point < 0x10000)
+            {
+                result.push_back(static_cast<char16_t>(code_point));
+            }
+            else
+            {
+                code_point -= 0x10000;
+                result.push_back(static_cast<char16_t>(0xD800 + (code_point >> 10)));
+                result.push_back(static_cast<char16_t>(0xDC00 + (code_point & 0x3FF)));
+            }
+        }
+        return result;
+    }
+
+    // A minimal perfect hash over a fixed set of keys: a key goes to bucket hash(key, 0) % size, and then to
+    // slot hash(key, seeds[bucket]) % size. Looking a key up is two hashes and a comparison against the key in
+    // its slot, without any probing.
+    struct perfect_hash
+    {
+        std::vector<uint32_t> seeds;
+        // the slot of each key, in the order the keys were given in
+        std::vector<uint32_t> slots;
+    };
+
+    // Built with hash and displace: the largest buckets are placed first, each with the first seed which sends
+    // all of its keys to free slots. The keys have to be unique.
+    template <typename Key, typename Hash>
+    perfect_hash build_perfect_hash(std::vector<Key> const& keys, Hash&& hash)
+    {
+        perfect_hash result;
+        auto size = static_cast<uint32_t>(keys.size());
+        if (size == 0)
+        {
+            return result;
+        }
+
+        std::vector<std::vector<uint32_t>> buckets(size);
+        for (uint32_t key = 0; key < size; ++key)
+        {
+            buckets[hash(keys[key], 0) % size].push_back(key);
+        }
+
+        std::vector<uint32_t> order(size);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](uint32_t lhs, uint32_t rhs)
+        {
+            return buckets[lhs].size() > buckets[rhs].size();
+        });
+
+        result.seeds.resize(size);
+        result.slots.resize(size);
+        std::vector<bool> taken(size);
+        std::vector<uint32_t> candidate;
+        for (auto bucket : order)
+        {
+            auto const& members = buckets[bucket];
+            if (members.empty())
+            {
+                break;
+            }
+
+            for (uint32_t seed = 1;; ++seed)
+            {
+                if (seed == 1u << 20)
+                {
+                    throw_invalid("Could not build a perfect hash, the keys are not unique");
+                }
+
+                candidate.clear();
+                for (auto key : members)
+                {
+                    auto slot = hash(keys[key], seed) % size;
+                    if (taken[slot] || std::find(candidate.begin(), candidate.end(), slot) != candidate.end())
+                    {
+                        break;
+                    }
+                    candidate.push_back(slot);
+                }
+
+                if (candidate.size() == members.size())
+                {
+                    for (std::size_t i = 0; i < members.size(); ++i)
+                    {
+                        taken[candidate[i]] = true;
+                        result.slots[members[i]] = candidate[i];
+                    }
+                    result.seeds[bucket] = seed;
+                    break;
+                }
+            }
+        }
+
+        return result;
+    }
+}
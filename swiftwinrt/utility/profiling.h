@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace swiftwinrt
+{
+    // A named count (and optionally the time spent producing it) reported by `-profile`. Counters are process
+    // wide statics and are cheap enough to update unconditionally, so call sites don't need to check settings.
+    struct profile_counter
+    {
+        explicit profile_counter(std::string_view name) : m_name(name)
+        {
+            std::lock_guard lock{ registry_lock() };
+            registry().push_back(this);
+        }
+
+        profile_counter(profile_counter const&) = delete;
+        profile_counter& operator=(profile_counter const&) = delete;
+
+        void add(std::uint64_t count = 1) noexcept
+        {
+            m_count.fetch_add(count, std::memory_order_relaxed);
+        }
+
+        void add_time(std::chrono::nanoseconds elapsed) noexcept
+        {
+            m_elapsed.fetch_add(elapsed.count(), std::memory_order_relaxed);
+        }
+
+        std::string_view name() const noexcept
+        {
+            return m_name;
+        }
+
+        std::uint64_t count() const noexcept
+        {
+            return m_count.load(std::memory_order_relaxed);
+        }
+
+        std::chrono::nanoseconds elapsed() const noexcept
+        {
+            return std::chrono::nanoseconds{ m_elapsed.load(std::memory_order_relaxed) };
+        }
+
+        void reset() noexcept
+        {
+            m_count = 0;
+            m_elapsed = 0;
+        }
+
+        // All counters, sorted by name so that the report doesn't depend on static initialization order
+        static std::vector<profile_counter*> all()
+        {
+            std::lock_guard lock{ registry_lock() };
+            auto result = registry();
+            std::sort(result.begin(), result.end(), [](profile_counter const* lhs, profile_counter const* rhs)
+            {
+                return lhs->name() < rhs->name();
+            });
+            return result;
+        }
+
+        static void reset_all()
+        {
+            for (auto counter : all())
+            {
+                counter->reset();
+            }
+        }
+
+    private:
+        static std::vector<profile_counter*>& registry()
+        {
+            static std::vector<profile_counter*> counters;
+            return counters;
+        }
+
+        static std::mutex& registry_lock()
+        {
+            static std::mutex lock;
+            return lock;
+        }
+
+        std::string_view m_name;
+        std::atomic<std::uint64_t> m_count{};
+        std::atomic<std::int64_t> m_elapsed{};
+    };
+
+    // Heap allocations made while counting is on, counted by the replacement operator new in main.cpp. These are
+    // plain atomics rather than a profile_counter since registering a counter allocates.
+    inline std::atomic<bool> count_allocations{};
+    inline std::atomic<std::uint64_t> allocation_count{};
+
+    // Types written to the Swift projection, which the allocation count is reported against
+    inline profile_counter types_written{ "types written" };
+
+    // Adds the time spent in a scope to a counter
+    struct profile_scope
+    {
+        explicit profile_scope(profile_counter& counter) noexcept :
+            m_counter(counter),
+            m_start(std::chrono::steady_clock::now())
+        {
+        }
+
+        profile_scope(profile_scope const&) = delete;
+        profile_scope& operator=(profile_scope const&) = delete;
+
+        ~profile_scope() noexcept
+        {
+            m_counter.add_time(std::chrono::steady_clock::now() - m_start);
+        }
+
+    private:
+        profile_counter& m_counter;
+        std::chrono::steady_clock::time_point m_start;
+    };
+}
@@ -27,6 +27,24 @@ namespace swiftwinrt
         winmd::reader::filter projection_filter;
         winmd::reader::filter component_filter;
 
+        bool abi_filter{};
+        bool abi_shared_generics{};
+
+        uint32_t shard_index{};
+        uint32_t shard_count{};
+        bool merge{};
+
+        bool profile{};
+        bool factory_cache{};
+        std::set<std::string> eager_interfaces;
+        bool inlinable_abi{};
+
+        bool shared_generics{};
+        // the module which each shared generic instantiation is written into, by Swift name
+        std::map<std::string, std::string, std::less<>> generic_owners;
+
+        uint32_t split_namespaces{ 1 };
+
         bool fastabi{};
         std::map<winmd::reader::TypeDef, winmd::reader::TypeDef> fastabi_cache;
 
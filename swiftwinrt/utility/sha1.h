@@ -20,6 +20,14 @@ inline constexpr std::uint8_t* bigendian_copy(T value, std::uint8_t* target) noe
     return target;
 }
 
+inline constexpr std::uint32_t bigendian_load(std::uint8_t const* source) noexcept
+{
+    return (static_cast<std::uint32_t>(source[0]) << 24) |
+        (static_cast<std::uint32_t>(source[1]) << 16) |
+        (static_cast<std::uint32_t>(source[2]) << 8) |
+        static_cast<std::uint32_t>(source[3]);
+}
+
 struct sha1
 {
     static constexpr std::size_t chunk_size_bits = 512;
@@ -35,21 +43,36 @@ struct sha1
 
     constexpr void append(std::uint8_t const* data, std::uint64_t count) noexcept
     {
-        while (count > 0)
+        // Top up a partially filled chunk a byte at a time
+        while (count > 0 && m_nextChunkByte != 0)
         {
-            auto bytesToCopy = (std::min)(count, chunk_size_bytes - m_nextChunkByte);
-            for (std::size_t i = 0; i < bytesToCopy; ++i)
+            append_byte(*data++);
+            --count;
+            if (m_nextChunkByte == chunk_size_bytes)
             {
-                append_byte(data[i]);
+                process_chunk();
             }
+        }
 
-            if (m_nextChunkByte == chunk_size_bytes)
+        // Then process whole chunks straight from the input, a word at a time
+        while (count >= chunk_size_bytes)
+        {
+            for (std::size_t i = 0; i < chunk_size_ints; ++i)
             {
-                process_chunk();
+                m_currentChunk[i] = bigendian_load(data + i * 4);
             }
+            m_nextChunkByte = chunk_size_bytes;
+            m_sizeBytes += chunk_size_bytes;
+            process_chunk();
 
-            count -= bytesToCopy;
-            data += bytesToCopy;
+            count -= chunk_size_bytes;
+            data += chunk_size_bytes;
+        }
+
+        while (count > 0)
+        {
+            append_byte(*data++);
+            --count;
         }
     }
 
@@ -113,32 +136,37 @@ private:
         XLANG_ASSERT(m_nextChunkByte == chunk_size_bytes);
         auto chunkState = m_state;
 
-        std::array<std::uint32_t, 80> w = {};
-        for (auto i = 0; i < 16; ++i) w[i] = m_currentChunk[i];
-        for (auto i = 16; i < 80; ++i)
+        // The message schedule only ever looks back 16 words, so keep it in a ring over the chunk itself
+        // rather than expanding all 80 words up front
+        auto& w = m_currentChunk;
+        auto schedule = [&w](std::size_t i) constexpr noexcept
         {
-            w[i] = lrot(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
-        }
+            if (i >= 16)
+            {
+                w[i % 16] = lrot(w[(i - 3) % 16] ^ w[(i - 8) % 16] ^ w[(i - 14) % 16] ^ w[i % 16], 1);
+            }
+            return w[i % 16];
+        };
 
-        for (auto i = 0; i < 20; ++i)
+        for (std::size_t i = 0; i < 20; ++i)
         {
             auto f = (chunkState[1] & chunkState[2]) | (~chunkState[1] & chunkState[3]);
-            rotate(chunkState, w[i], f, 0x5A827999);
+            rotate(chunkState, schedule(i), f, 0x5A827999);
         }
-        for (auto i = 20; i < 40; ++i)
+        for (std::size_t i = 20; i < 40; ++i)
         {
             auto f = chunkState[1] ^ chunkState[2] ^ chunkState[3];
-            rotate(chunkState, w[i], f, 0x6ED9EBA1);
+            rotate(chunkState, schedule(i), f, 0x6ED9EBA1);
         }
-        for (auto i = 40; i < 60; ++i)
+        for (std::size_t i = 40; i < 60; ++i)
         {
             auto f = (chunkState[1] & chunkState[2]) | (chunkState[1] & chunkState[3]) | (chunkState[2] & chunkState[3]);
-            rotate(chunkState, w[i], f, 0x8F1BBCDC);
+            rotate(chunkState, schedule(i), f, 0x8F1BBCDC);
         }
-        for (auto i = 60; i < 80; ++i)
+        for (std::size_t i = 60; i < 80; ++i)
         {
             auto f = chunkState[1] ^ chunkState[2] ^ chunkState[3];
-            rotate(chunkState, w[i], f, 0xCA62C1D6);
+            rotate(chunkState, schedule(i), f, 0xCA62C1D6);
         }
 
         for (auto i = 0; i < 5; ++i)
@@ -0,0 +1,254 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace swiftwinrt
+{
+    // A piece of the projection which is generated by a single shard, i.e. the C header for a
+    // namespace ("abi Windows.Foundation") or the Swift files for a module ("module UWP")
+    struct shard_unit
+    {
+        std::string name;
+        std::size_t estimated_size{};
+    };
+
+    inline std::string shard_unit_name(std::string_view kind, std::string_view name)
+    {
+        std::string result{ kind };
+        result += ' ';
+        result += name;
+        return result;
+    }
+
+    // Identifies the inputs and options of a run, so that -merge only reads manifests written by shards of the same
+    // run and not ones left in the output folder by an earlier run. FNV-1a, since it only has to tell runs apart.
+    struct shard_fingerprint
+    {
+        void add(std::string_view value) noexcept
+        {
+            for (auto c : value)
+            {
+                m_hash = (m_hash ^ static_cast<uint8_t>(c)) * 0x100000001b3ull;
+            }
+            // a separator, so that "ab" + "c" and "a" + "bc" differ
+            m_hash = (m_hash ^ 0xff) * 0x100000001b3ull;
+        }
+
+        void add(uint64_t value)
+        {
+            add(std::to_string(value));
+        }
+
+        // Hashes what's in the file rather than its path or timestamp, so that every shard of a run agrees on it
+        // wherever its copy of the metadata lives, and a rewrite with the same contents doesn't tell runs apart
+        void add_contents(std::filesystem::path const& path)
+        {
+            std::ifstream file(path, std::ios::binary);
+            if (!file)
+            {
+                throw_invalid("Could not read '", path.string(), "'");
+            }
+            char buffer[64 * 1024];
+            while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+            {
+                for (std::streamsize i = 0; i < file.gcount(); ++i)
+                {
+                    m_hash = (m_hash ^ static_cast<uint8_t>(buffer[i])) * 0x100000001b3ull;
+                }
+            }
+            m_hash = (m_hash ^ 0xff) * 0x100000001b3ull;
+        }
+
+        std::string str() const
+        {
+            char buffer[17];
+            std::snprintf(buffer, sizeof(buffer), "%016llx", static_cast<unsigned long long>(m_hash));
+            return buffer;
+        }
+
+    private:
+        uint64_t m_hash{ 0xcbf29ce484222325ull };
+    };
+
+    // Deterministically assigns units to shards. Every shard sees the same metadata and so builds the same
+    // list of units, which means each one computes the same assignment without having to coordinate.
+    struct shard_plan
+    {
+        shard_plan() = default;
+
+        shard_plan(std::vector<shard_unit> units, uint32_t index, uint32_t count) : m_index(index), m_count(count)
+        {
+            if (m_count == 0)
+            {
+                return;
+            }
+
+            // largest units first so that the greedy assignment stays balanced, ties broken by name so
+            // that the order doesn't depend on how the units were collected
+            std::sort(units.begin(), units.end(), [](shard_unit const& lhs, shard_unit const& rhs)
+            {
+                if (lhs.estimated_size != rhs.estimated_size)
+                {
+                    return lhs.estimated_size > rhs.estimated_size;
+                }
+                return lhs.name < rhs.name;
+            });
+
+            std::vector<std::size_t> loads(m_count);
+            for (auto& unit : units)
+            {
+                auto target = static_cast<uint32_t>(std::min_element(loads.begin(), loads.end()) - loads.begin());
+                loads[target] += std::max<std::size_t>(unit.estimated_size, 1);
+                if (target + 1 == m_index)
+                {
+                    m_owned.insert(unit.name);
+                }
+            }
+        }
+
+        bool sharded() const noexcept
+        {
+            return m_count != 0;
+        }
+
+        bool owns(std::string const& unit) const
+        {
+            return !sharded() || m_owned.contains(unit);
+        }
+
+        std::filesystem::path manifest_path(std::filesystem::path const& output_folder) const
+        {
+            return output_folder / ("swiftwinrt.shard-" + std::to_string(m_index) + "-of-" + std::to_string(m_count) + ".txt");
+        }
+
+        void write_manifest(std::filesystem::path const& output_folder, std::string const& fingerprint) const
+        {
+            std::ofstream file;
+            file.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+            file.open(manifest_path(output_folder), std::ios::out | std::ios::binary);
+            file << "shard " << m_index << '/' << m_count << ' ' << fingerprint << '\n';
+            for (auto& unit : m_owned)
+            {
+                file << unit << '\n';
+            }
+        }
+
+    private:
+        uint32_t m_index{};
+        uint32_t m_count{};
+        std::set<std::string> m_owned;
+    };
+
+    inline std::pair<uint32_t, uint32_t> parse_shard(std::string const& value)
+    {
+        std::regex rx(R"((\d+)/(\d+))");
+        std::smatch match;
+        if (!std::regex_match(value, match, rx))
+        {
+            throw_invalid("Shard '", value, "' must be of the form <index>/<count>");
+        }
+
+        auto index = static_cast<uint32_t>(std::stoul(match[1].str()));
+        auto count = static_cast<uint32_t>(std::stoul(match[2].str()));
+        if (count == 0 || index == 0 || index > count)
+        {
+            throw_invalid("Shard '", value, "' must have an index between 1 and the shard count");
+        }
+
+        return { index, count };
+    }
+
+    // Reads back the manifests written by each shard and checks that together they cover exactly the
+    // units which a single process would have generated. Manifests with a different fingerprint are left over
+    // from an earlier run and ignored. If runs with the same inputs but different shard counts left manifests
+    // behind, those of the most recently written count are used.
+    inline void verify_shard_manifests(std::filesystem::path const& output_folder, std::vector<shard_unit> const& units, std::string const& fingerprint)
+    {
+        struct manifest_info
+        {
+            std::set<uint32_t> shards;
+            std::set<std::string> covered;
+            std::filesystem::file_time_type last_written{};
+        };
+
+        std::regex rx(R"(swiftwinrt\.shard-(\d+)-of-(\d+)\.txt)");
+        std::map<uint32_t, manifest_info> by_count;
+        bool found_any{};
+
+        for (auto&& file : std::filesystem::directory_iterator(output_folder))
+        {
+            auto filename = file.path().filename().string();
+            std::smatch match;
+            if (!std::regex_match(filename, match, rx))
+            {
+                continue;
+            }
+            found_any = true;
+
+            std::ifstream manifest(file.path());
+            std::string line;
+            std::getline(manifest, line); // "shard i/N <fingerprint>" header
+
+            std::istringstream header(line);
+            std::string word, shard, manifest_fingerprint;
+            header >> word >> shard >> manifest_fingerprint;
+            if (manifest_fingerprint != fingerprint)
+            {
+                continue;
+            }
+
+            auto& info = by_count[static_cast<uint32_t>(std::stoul(match[2].str()))];
+            info.shards.insert(static_cast<uint32_t>(std::stoul(match[1].str())));
+            info.last_written = std::max(info.last_written, file.last_write_time());
+            while (std::getline(manifest, line))
+            {
+                if (!line.empty())
+                {
+                    info.covered.insert(line);
+                }
+            }
+        }
+
+        if (by_count.empty())
+        {
+            if (found_any)
+            {
+                throw_invalid("The shard manifests in '", output_folder.string(), "' were written with different inputs or options");
+            }
+            throw_invalid("No shard manifests found in '", output_folder.string(), "'");
+        }
+
+        auto latest = std::max_element(by_count.begin(), by_count.end(), [](auto const& lhs, auto const& rhs)
+        {
+            return lhs.second.last_written < rhs.second.last_written;
+        });
+        auto count = latest->first;
+        auto const& info = latest->second;
+
+        for (uint32_t i = 1; i <= count; ++i)
+        {
+            if (!info.shards.contains(i))
+            {
+                throw_invalid("Missing manifest for shard ", std::to_string(i), "/", std::to_string(count));
+            }
+        }
+
+        for (auto& unit : units)
+        {
+            if (!info.covered.contains(unit.name))
+            {
+                throw_invalid("'", unit.name, "' was not generated by any shard");
+            }
+        }
+    }
+}
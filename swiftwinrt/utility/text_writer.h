@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cassert>
+#include <cstdio>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
@@ -129,8 +130,21 @@ namespace swiftwinrt
         void write_printf(char const* format, Args const&... args)
         {
             char buffer[128];
-            size_t const size = sprintf_s(buffer, format, args...);
-            write(std::string_view{ buffer, size });
+            int const size = snprintf(buffer, sizeof(buffer), format, args...);
+            if (size < 0)
+            {
+                return;
+            }
+
+            if (static_cast<size_t>(size) < sizeof(buffer))
+            {
+                write(std::string_view{ buffer, static_cast<size_t>(size) });
+                return;
+            }
+
+            std::string large(static_cast<size_t>(size), '\0');
+            snprintf(large.data(), large.size() + 1, format, args...);
+            write(large);
         }
 
         /*template <auto F, typename... Args>
@@ -434,7 +448,7 @@ namespace swiftwinrt
         }
 
         write_scope_guard(write_scope_guard const&) = delete;
-        write_scope_guard(write_scope_guard&& rhs) : m_writer(rhs.m_writer), m_lines(std::move(rhs.m_lines)) {}
+        write_scope_guard(write_scope_guard&& rhs) : m_writer(rhs.m_writer), m_lines(std::move(rhs.m_lines)), m_closing_lines(std::move(rhs.m_closing_lines)) {}
         ~write_scope_guard() noexcept
         {
             if (m_guard.has_value())
@@ -442,7 +456,7 @@ namespace swiftwinrt
                 m_guard.value().end();
             }
             auto on_new_line = m_writer.back() == '\n';
-            if (!on_new_line && !m_lines.empty() && m_start_on_new_line)
+            if (!on_new_line && (!m_lines.empty() || !m_closing_lines.empty()) && m_start_on_new_line)
             {
                 m_writer.write("\n");
             }
@@ -450,6 +464,10 @@ namespace swiftwinrt
             {
                 m_writer.write(line);
             }
+            for (auto& line : m_closing_lines)
+            {
+                m_writer.write(line);
+            }
         }
 
         template <typename... Args>
@@ -469,6 +487,16 @@ namespace swiftwinrt
             m_lines.insert(m_lines.begin(), temp_writer.write_temp(format, indent { m_offset }, args...));
         }
 
+        // Closes a scope opened by the caller. These are written after all of the other lines so that any locals
+        // declared inside of the scope stay in scope for them.
+        template <typename... Args>
+        void push_closing(std::string_view const& value, Args const&... args)
+        {
+            T temp_writer;
+            temp_writer.swift_module = m_swift_module;
+            m_closing_lines.push_back(temp_writer.write_temp(value, args...));
+        }
+
         void push_indent(indent indent = { 1 })
         {
             m_offset += indent.additional_indentation;
@@ -479,6 +507,7 @@ namespace swiftwinrt
         writer_type& m_writer;
         size_t m_offset{};
         std::vector<std::string> m_lines;
+        std::vector<std::string> m_closing_lines;
         std::optional<typename writer_type::indent_guard> m_guard;
         bool m_start_on_new_line{};
         std::string m_swift_module;
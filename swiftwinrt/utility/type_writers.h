@@ -246,6 +246,33 @@ namespace swiftwinrt
             {
                 depends.insert(std::string(type_module));
             }
+
+            if (dynamic_cast<generic_inst const*>(&type))
+            {
+                generic_module(type);
+            }
+        }
+
+        // Generic instantiations are written into every module which uses them, unless -shared-generics gave
+        // them an owning module which the others import them from
+        std::string_view generic_module(metadata_type const& type)
+        {
+            auto owner = settings.generic_owners.find(type.swift_full_name());
+            if (owner == settings.generic_owners.end())
+            {
+                return swift_module;
+            }
+
+            if (owner->second != swift_module)
+            {
+                depends.insert(owner->second);
+            }
+            return owner->second;
+        }
+
+        std::string_view generic_module(metadata_type const* type)
+        {
+            return generic_module(*type);
         }
 
         [[nodiscard]] auto push_generic_params(generic_inst const& signature)
@@ -664,7 +691,7 @@ namespace swiftwinrt
             return root_directory() / swift_module;
         }
 
-        void save_file(std::string_view const& ext = "")
+        std::filesystem::path file_path(std::string_view const& ext = "")
         {
             auto filename = type_namespace;
 
@@ -675,7 +702,12 @@ namespace swiftwinrt
             }
 
             filename += ".swift";
-            flush_to_file(project_directory() / filename);
+            return project_directory() / filename;
+        }
+
+        void save_file(std::string_view const& ext = "")
+        {
+            flush_to_file(file_path(ext));
         }
 
         void save_header()
@@ -0,0 +1,56 @@
+import WinSDK
+import XCTest
+import test_component
+@_spi(WinRTInternal) import WindowsFoundation
+import Foundation
+
+class ActivationFactoryCacheTests : XCTestCase {
+  // the cache is process wide, so factories kept by one test would otherwise be found by the next
+  override func setUp() {
+    ActivationFactoryCache.reset()
+  }
+
+  override func tearDown() {
+    ActivationFactoryCache.reset()
+  }
+
+  public func testResolve() throws {
+    let factory: WindowsFoundation.IActivationFactory = try ActivationFactoryCache.factory("test_component.Simple")
+    XCTAssertNotNil(try factory.ActivateInstance())
+  }
+
+  public func testReuseAgileFactories() throws {
+    ActivationFactoryCache.reuseAgileFactories = true
+    ActivationFactoryCache.prewarm(["test_component.Simple"])
+
+    let first: WindowsFoundation.IActivationFactory = try ActivationFactoryCache.factory("test_component.Simple")
+    let second: WindowsFoundation.IActivationFactory = try ActivationFactoryCache.factory("test_component.Simple")
+    XCTAssertEqual(first.pUnk.borrow, second.pUnk.borrow)
+    XCTAssertNotNil(try second.ActivateInstance())
+  }
+
+  public func testPrewarmKeepsFactoriesWithoutReuse() throws {
+    XCTAssertFalse(ActivationFactoryCache.isKept("test_component.Simple"))
+    ActivationFactoryCache.prewarm(["test_component.Simple"])
+    XCTAssertTrue(ActivationFactoryCache.isKept("test_component.Simple"))
+
+    let first: WindowsFoundation.IActivationFactory = try ActivationFactoryCache.factory("test_component.Simple")
+    let second: WindowsFoundation.IActivationFactory = try ActivationFactoryCache.factory("test_component.Simple")
+    XCTAssertEqual(first.pUnk.borrow, second.pUnk.borrow)
+  }
+
+  public func testPrewarmIgnoresUnknownClasses() throws {
+    ActivationFactoryCache.prewarm(["test_component.DoesNotExist"])
+    XCTAssertFalse(ActivationFactoryCache.isKept("test_component.DoesNotExist"))
+    XCTAssertThrowsError(try ActivationFactoryCache.factory("test_component.DoesNotExist") as WindowsFoundation.IActivationFactory)
+  }
+}
+
+var activationFactoryCacheTests: [XCTestCaseEntry] = [
+  testCase([
+    ("testResolve", ActivationFactoryCacheTests.testResolve),
+    ("testReuseAgileFactories", ActivationFactoryCacheTests.testReuseAgileFactories),
+    ("testPrewarmKeepsFactoriesWithoutReuse", ActivationFactoryCacheTests.testPrewarmKeepsFactoriesWithoutReuse),
+    ("testPrewarmIgnoresUnknownClasses", ActivationFactoryCacheTests.testPrewarmIgnoresUnknownClasses)
+  ])
+]
@@ -1,6 +1,6 @@
 import WinSDK
 import XCTest
-import test_component
+@_spi(WinRTInternal) import test_component
 @_spi(WinRTInternal) import WindowsFoundation
 
 import Foundation
@@ -56,6 +56,19 @@ class AggregationTests : XCTestCase {
     XCTAssert(type(of: base_returned) == Derived.self)
   }
 
+  public func testMakerTableMatchesMakers() throws {
+    // makeFrom(abi:) finds the derived type above through the generated table, so each name
+    // has to line up with the maker in the same slot
+    let names = test_component.__MakerTable.names
+    let makers = test_component.__MakerTable.makers
+    XCTAssertEqual(names.count, makers.count)
+    XCTAssertEqual(Set(names).count, names.count)
+    for (name, maker) in zip(names, makers) {
+      XCTAssertEqual("\(name.split(separator: ".").last!)Maker", String(describing: maker))
+    }
+    XCTAssert(names.contains("test_component.Derived"))
+  }
+
   public func testUnwrappingAppImplementedComposedTypeBase() throws {
     let classy = Class()
     let appDerived = AppDerived()
@@ -111,6 +124,33 @@ class AggregationTests : XCTestCase {
     XCTAssertIdentical(baseNoOverrides_returned, derivedNoOverrides2)
   }
 
+  public func testQueryInterfaceDispatch() throws {
+    let derived = AppDerived3()
+    let overrides = [
+      __ABI_test_component.IBaseOverridesWrapper.IID,
+      __ABI_test_component.IUnsealedDerivedOverridesWrapper.IID,
+      __ABI_test_component.IUnsealedDerivedOverloads2Wrapper.IID,
+    ]
+
+    // Shares Data1 with IUnsealedDerivedOverrides, so only comparing the whole IID tells them apart
+    var lookalike = __ABI_test_component.IUnsealedDerivedOverridesWrapper.IID
+    lookalike.Data2 &+= 1
+    XCTAssertNil(derived.queryInterface(lookalike))
+
+    let iterations = 100_000
+    var found = 0
+    let clock = ContinuousClock()
+    let time = clock.measure {
+      for _ in 0..<iterations {
+        for iid in overrides where derived.queryInterface(iid) != nil {
+          found += 1
+        }
+      }
+    }
+    print("querying \(overrides.count) overridable interfaces \(iterations) times: \(time)")
+    XCTAssertEqual(found, overrides.count * iterations)
+  }
+
   public func testCustomConstructorOnUnsealedType() throws {
     let derived = UnsealedDerived(32)
     XCTAssertEqual(derived.prop, 32)
@@ -150,11 +190,13 @@ var aggregationTests: [XCTestCaseEntry] = [
     ("testOverrideMultipleInterface", AggregationTests.testOverrideMultipleInterface),
     ("testComposedTypesAsInput", AggregationTests.testComposedTypesAsInput),
     ("testUnwrappingWinRTImplementedComposedType", AggregationTests.testUnwrappingWinRTImplementedComposedType),
+    ("testMakerTableMatchesMakers", AggregationTests.testMakerTableMatchesMakers),
     ("testUnwrappingAppImplementedComposedTypeBase", AggregationTests.testUnwrappingAppImplementedComposedTypeBase),
     ("testUnwrappingAppImplementedComposedTypeDerive", AggregationTests.testUnwrappingAppImplementedComposedTypeDerive),
     ("testUnwrappingAppImplementedComposedTypeDerive3", AggregationTests.testUnwrappingAppImplementedComposedTypeDerive3),
     ("testUnwrappingAppImplementedComposedFromBaseNoOverrides", AggregationTests.testUnwrappingAppImplementedComposedFromBaseNoOverrides),
     ("testUnwrappingAppImplementedComposedFromDerivedNoOverrides", AggregationTests.testUnwrappingAppImplementedComposedFromDerivedNoOverrides),
+    ("testQueryInterfaceDispatch", AggregationTests.testQueryInterfaceDispatch),
     ("testCustomConstructorOnUnsealedType", AggregationTests.testCustomConstructorOnUnsealedType),
     ("testGetRuntimeClassNameReturnsBase", AggregationTests.testGetRuntimeClassNameReturnsBase),
     ("testAggregatedObjectUnwrappedAsAny", AggregationTests.testAggregatedObjectUnwrappedAsAny),
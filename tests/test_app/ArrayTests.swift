@@ -1,8 +1,8 @@
 import WinSDK
 import XCTest
-import test_component
+@_spi(WinRTInternal) import test_component
 import Foundation
-import WindowsFoundation
+@_spi(WinRTInternal) import WindowsFoundation
 
 class StringableInt: IStringable {
     let value: Int32
@@ -72,6 +72,27 @@ class ArrayInputTests : XCTestCase {
         XCTAssertEqual("1234", result)
     }
 
+    public func testBlittableStructArrayHasAbiLayout() throws {
+        XCTAssertTrue(BlittableStruct.hasAbiLayout)
+        XCTAssertTrue(Rect.hasAbiLayout)
+
+        let input = (Int32(0)..<1000).map { BlittableStruct(first: $0, second: -$0) }
+        try input.toABI { abi in
+            XCTAssertEqual(input, [BlittableStruct].from(abi: abi))
+        }
+    }
+
+    public func testBlittableStructCopiesToAndFromAbi() throws {
+        let rect = Rect(x: 1, y: 2, width: 3, height: 4)
+        let abi = rect.toABI()
+        XCTAssertEqual([abi.X, abi.Y, abi.Width, abi.Height], [1, 2, 3, 4])
+        XCTAssertEqual(rect, Rect.from(abi: abi))
+
+        let blittableStruct = BlittableStruct.from(abi: .init(First: 5, Second: 6))
+        XCTAssertEqual(blittableStruct, BlittableStruct(first: 5, second: 6))
+        XCTAssertEqual(blittableStruct.toABI().Second, 6)
+    }
+
     public func testInNonBlittableStructArray() throws {
         let input: [NonBlittableStruct] = [NonBlittableStruct(first: "1", second: "2", third: 3, fourth: "4"), NonBlittableStruct(first: "5", second: "6", third: 7, fourth: "8")]
         let result = try ArrayMethods.inNonBlittableStructArray(input)
@@ -180,6 +201,17 @@ public class ArrayByReferenceTests: XCTestCase {
         XCTAssertEqual(["1", "2", "3", "4", nil], mapped)
     }
 
+    public func testStringableArrayByReferenceOwnsElements() throws {
+        var input = [AnyIStringable?](repeating: nil, count: 5)
+        try ArrayMethods.refStringableArray(&input)
+        let first = try XCTUnwrap(input[0] as? any WinRTAbiImpl<__IMPL_Windows_Foundation.IStringableBridge>)._default
+        input = []
+
+        // The array held the only other reference to the element, so `first` is now the last one
+        _ = first.AddRef()
+        XCTAssertEqual(first.Release(), 1)
+    }
+
     public func testInStructArrayByReference() throws {
         var input = [BlittableStruct](repeating: BlittableStruct(first: 10, second: 10), count: 3)
         try ArrayMethods.refStructArray(&input)
@@ -272,6 +304,8 @@ private let inputArrayTests: [XCTestCaseEntry] = [
     ("testInObjectArray", ArrayInputTests.testInObjectArray),
     ("testInStringableArray", ArrayInputTests.testInStringableArray),
     ("testInStructArray", ArrayInputTests.testInStructArray),
+    ("testBlittableStructArrayHasAbiLayout", ArrayInputTests.testBlittableStructArrayHasAbiLayout),
+    ("testBlittableStructCopiesToAndFromAbi", ArrayInputTests.testBlittableStructCopiesToAndFromAbi),
     ("testInNonBlittableStructArray", ArrayInputTests.testInNonBlittableStructArray),
     ("testInEnumArray", ArrayInputTests.testInEnumArray),
     ("testThroughSwiftImplementation", ArrayInputTests.testThroughSwiftImplementation)
@@ -296,6 +330,7 @@ private let referenceArrayTests: [XCTestCaseEntry] = [
     ("testInStringArrayByReference", ArrayByReferenceTests.testInStringArrayByReference),
     ("testInObjectArrayByReference", ArrayByReferenceTests.testInObjectArrayByReference),
     ("testInStringableArrayByReference", ArrayByReferenceTests.testInStringableArrayByReference),
+    ("testStringableArrayByReferenceOwnsElements", ArrayByReferenceTests.testStringableArrayByReferenceOwnsElements),
     ("testInStructArrayByReference", ArrayByReferenceTests.testInStructArrayByReference),
     ("testInNonBlittableStructArrayByReference", ArrayByReferenceTests.testInNonBlittableStructArrayByReference),
     ("testInEnumArrayByReference", ArrayByReferenceTests.testInEnumArrayByReference),
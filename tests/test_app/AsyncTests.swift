@@ -42,6 +42,163 @@ class AsyncTests : XCTestCase {
     }
   }
 
+  public func testCancellingAwaitCancelsOperation() throws {
+    let asyncOperation = try AsyncMethods.getPendingAsync()!
+    let task = Task { try await asyncOperation.get() }
+    runAfter(delay: 0.05) { task.cancel() }
+    do {
+      _ = try asyncBlock(timeout: 1) { try await task.value }
+      XCTFail("Expected the await to be cancelled")
+    } catch is CancellationError {
+      XCTAssertEqual(asyncOperation.status, .canceled)
+    }
+  }
+
+  public func testProgressUpdates() throws {
+    let methods = MethodsWithProgress()
+    let asyncOperation = try methods.operationWithProgress(DateTime())!
+    let updates = asyncOperation.progressUpdates()
+    runAfter(delay: 0.05) {
+      methods.operation.report(0.25)
+      methods.operation.report(0.5)
+      methods.operation.complete(42)
+    }
+    let reported: [Double] = try asyncBlock(timeout: 1) {
+      var reported: [Double] = []
+      for await progress in updates {
+        reported.append(progress)
+      }
+      return reported
+    }
+    XCTAssertEqual(reported, [0.25, 0.5])
+    XCTAssertEqual(try asyncBlock(timeout: 1) { try await asyncOperation.get() }, 42)
+  }
+
+  // The operation only lets its handlers be set once, so every iteration and get() have to share them
+  public func testGetWhileIteratingProgressUpdates() throws {
+    let methods = MethodsWithProgress()
+    let asyncOperation = try methods.operationWithProgress(DateTime())!
+    let first = asyncOperation.progressUpdates()
+    let second = asyncOperation.progressUpdates()
+    runAfter(delay: 0.05) {
+      methods.operation.report(0.5)
+      methods.operation.complete(42)
+    }
+    let (result, firstCount, secondCount): (Int32, Int, Int) = try asyncBlock(timeout: 1) {
+      async let result = asyncOperation.get()
+      async let firstCount = first.reduce(0) { count, _ in count + 1 }
+      async let secondCount = second.reduce(0) { count, _ in count + 1 }
+      return try await (result, firstCount, secondCount)
+    }
+    XCTAssertEqual(result, 42)
+    XCTAssertEqual(firstCount, 1)
+    XCTAssertEqual(secondCount, 1)
+  }
+
+  public func testBreakingOutOfProgressUpdatesLeavesOperationRunning() throws {
+    let methods = MethodsWithProgress()
+    let asyncOperation = try methods.operationWithProgress(DateTime())!
+    let updates = asyncOperation.progressUpdates()
+    runAfter(delay: 0.05) { methods.operation.report(0.5) }
+    let first: Double? = try asyncBlock(timeout: 1) {
+      for await progress in updates {
+        return progress
+      }
+      return nil
+    }
+    XCTAssertEqual(first, 0.5)
+    XCTAssertEqual(asyncOperation.status, .started)
+
+    runAfter(delay: 0.05) { methods.operation.complete(42) }
+    XCTAssertEqual(try asyncBlock(timeout: 1) { try await asyncOperation.get() }, 42)
+  }
+
+  public func testCancellingProgressUpdatesCancelsOperation() throws {
+    let methods = MethodsWithProgress()
+    let asyncOperation = try methods.operationWithProgress(DateTime())!
+    let updates = asyncOperation.progressUpdates()
+    let task = Task {
+      for await _ in updates {}
+    }
+    runAfter(delay: 0.05) { task.cancel() }
+    try asyncBlock(timeout: 1) { await task.value }
+    XCTAssertEqual(asyncOperation.status, .canceled)
+  }
+
+  private class MethodsWithProgress: IAsyncMethodsWithProgress {
+    let operation = OperationWithProgress()
+
+    func operationWithProgress(_ value: DateTime) throws -> AnyIAsyncOperationWithProgress<Int32, Double>! {
+      operation
+    }
+  }
+
+  /// Like the operations implemented by WinRT, this only lets its handlers be set once
+  private class OperationWithProgress: IAsyncOperationWithProgress {
+    typealias TResult = Int32
+    typealias TProgress = Double
+
+    private let lock = NSLock()
+    private var result: Int32 = 0
+    private var _status: AsyncStatus = .started
+    private var _progress: AsyncOperationProgressHandler<Int32, Double>?
+    private var _completed: AsyncOperationWithProgressCompletedHandler<Int32, Double>?
+
+    var id: UInt32 { 1 }
+    var errorCode: HRESULT { S_OK }
+    var status: AsyncStatus { lock.withLock { _status } }
+
+    var progress: AsyncOperationProgressHandler<Int32, Double>? {
+      get { lock.withLock { _progress } }
+      set {
+        lock.withLock {
+          XCTAssertNil(_progress, "the progress handler can only be set once")
+          _progress = newValue
+        }
+      }
+    }
+
+    var completed: AsyncOperationWithProgressCompletedHandler<Int32, Double>? {
+      get { lock.withLock { _completed } }
+      set {
+        let alreadyCompleted: Bool = lock.withLock {
+          XCTAssertNil(_completed, "the completed handler can only be set once")
+          _completed = newValue
+          return _status != .started
+        }
+        if alreadyCompleted {
+          try? newValue?(self, status)
+        }
+      }
+    }
+
+    func getResults() throws -> Int32 {
+      guard status == .completed else { throw WindowsFoundation.Error(hr: E_ILLEGAL_METHOD_CALL) }
+      return lock.withLock { result }
+    }
+
+    func cancel() throws { finish(.canceled) }
+    func close() throws {}
+
+    func report(_ value: Double) {
+      try? progress?(self, value)
+    }
+
+    func complete(_ result: Int32) {
+      lock.withLock { self.result = result }
+      finish(.completed)
+    }
+
+    private func finish(_ status: AsyncStatus) {
+      let completed: AsyncOperationWithProgressCompletedHandler<Int32, Double>? = lock.withLock {
+        guard _status == .started else { return nil }
+        _status = status
+        return _completed
+      }
+      try? completed?(self, status)
+    }
+  }
+
   /// Runs a block asynchronously after a delay has elapsed
   private func runAfter(delay: TimeInterval, body: @escaping () -> Void) {
     Task {
@@ -92,5 +249,10 @@ var asyncTests: [XCTestCaseEntry] = [
     ("testAwaitAlreadyFailed", AsyncTests.testAwaitAlreadyFailed),
     ("testAwaitCompletionWithSuspension", AsyncTests.testAwaitCompletionWithSuspension),
     ("testAwaitFailureWithSuspension", AsyncTests.testAwaitFailureWithSuspension),
+    ("testCancellingAwaitCancelsOperation", AsyncTests.testCancellingAwaitCancelsOperation),
+    ("testProgressUpdates", AsyncTests.testProgressUpdates),
+    ("testGetWhileIteratingProgressUpdates", AsyncTests.testGetWhileIteratingProgressUpdates),
+    ("testBreakingOutOfProgressUpdatesLeavesOperationRunning", AsyncTests.testBreakingOutOfProgressUpdatesLeavesOperationRunning),
+    ("testCancellingProgressUpdatesCancelsOperation", AsyncTests.testCancellingProgressUpdatesCancelsOperation),
   ])
 ]
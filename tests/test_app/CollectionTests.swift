@@ -42,6 +42,31 @@ class CollectionTests : XCTestCase {
     XCTAssertEqual(vector2[2], "Goodnight")
   }
 
+  public func testVector_iterateInBatches() throws {
+    let tester = CollectionTester()
+    let vector = try tester.returnStoredStringVector()!
+    vector.clear()
+    for i in 0..<10 {
+      vector.append(String(i))
+    }
+    let expected = (0..<10).map { String($0) }
+
+    // Iterating fetches the elements with GetMany, indexing makes a GetAt call per element
+    XCTAssertEqual((0..<vector.count).map { vector[$0] }, expected)
+    XCTAssertEqual(Array(vector), expected)
+
+    // A batch size which doesn't divide the count leaves a partial batch at the end
+    var iterator = VectorIterator(vector, placeholder: "", batchSize: 3)
+    var iterated: [String] = []
+    while let item = iterator.next() {
+      iterated.append(item)
+    }
+    XCTAssertEqual(iterated, expected)
+
+    vector.clear()
+    XCTAssertEqual(Array(vector), [])
+  }
+
   public func testArrayVectorIsIterable() throws {
     try XCTSkipIf(true, "TODO(#159)")
     XCTAssertNotNil(try CollectionTester.vectorAsIterable(["a", "b", "c"].toVector()))
@@ -93,6 +118,7 @@ var collectionTests: [XCTestCaseEntry] = [
     ("testVector_asInput", CollectionTests.testVector_asInput),
     ("testVector_asReturn", CollectionTests.testVector_asReturn),
     ("testVector_mutate", CollectionTests.testVector_mutate),
+    ("testVector_iterateInBatches", CollectionTests.testVector_iterateInBatches),
     ("testArrayVectorIsIterable", CollectionTests.testArrayVectorIsIterable),
     ("testVectorObject_toCallback", CollectionTests.testVectorObject_toCallback),
   ])
@@ -46,6 +46,27 @@ class EventTests : XCTestCase {
     XCTAssertEqual(count, 3)
   }
 
+  // Handlers are wrapped for the ABI by the Event itself, make sure that the same handler value
+  // added twice is registered twice and that each registration is removed on its own
+  public func testSameHandlerAddedTwice() throws {
+    let simple = Simple()
+    var count = 0
+    let handler: SignalDelegate = { count += 1 }
+
+    let first = simple.signalEvent.addHandler(handler)
+    let second = simple.signalEvent.addHandler(handler)
+    try simple.fireEvent()
+    XCTAssertEqual(count, 2)
+
+    first.dispose()
+    try simple.fireEvent()
+    XCTAssertEqual(count, 3)
+
+    second.dispose()
+    try simple.fireEvent()
+    XCTAssertEqual(count, 3)
+  }
+
   public func testStaticEvent() throws {
     var static_count = 0
 
@@ -128,13 +149,77 @@ public func testSwiftImplementedEventWithSwiftListener() throws {
     delegate.fireEvent(expectedResult)
     XCTAssertEqual(count, 3)
   }
+
+  // Whatever a handler captures is released once the handler is removed, even when that happens during a
+  // raise and nothing is added or removed afterwards
+  public func testEventSource_handlerRemovedDuringRaiseIsReleased() throws {
+    class Captured {}
+    let source = EventSource<() -> Void>()
+    weak var weakCaptured: Captured?
+    do {
+      let captured = Captured()
+      weakCaptured = captured
+      var cleanup: EventCleanup?
+      cleanup = source.wrappedValue.addHandler {
+        _ = captured
+        cleanup?.dispose()
+        cleanup = nil
+      }
+    }
+
+    XCTAssertNotNil(weakCaptured)
+    source.invokeAll { $0() }
+    XCTAssertNil(weakCaptured)
+  }
+
+  // Half of the threads raise the event while the other half add and remove handlers. Every raise
+  // has to see the handlers which stay subscribed and at most one extra handler per other thread.
+  public func testEventSource_contention() throws {
+    let source = EventSource<() -> Void>()
+    let event = source.wrappedValue
+    let subscribed = 8
+    for _ in 0..<subscribed {
+      event.addHandler {}
+    }
+
+    let threads = 8
+    let iterations = 10_000
+    var unexpectedRaises = [Int](repeating: 0, count: threads)
+    let clock = ContinuousClock()
+    let time = clock.measure {
+      unexpectedRaises.withUnsafeMutableBufferPointer { unexpectedRaises in
+        DispatchQueue.concurrentPerform(iterations: threads) { thread in
+          for _ in 0..<iterations {
+            if thread % 2 == 0 {
+              var count = 0
+              source.invokeAll { $0(); count += 1 }
+              if count < subscribed || count > subscribed + threads / 2 {
+                unexpectedRaises[thread] += 1
+              }
+            } else {
+              event.addHandler {}.dispose()
+            }
+          }
+        }
+      }
+    }
+    print("\(threads) threads raising or adding and removing handlers \(iterations) times: \(time)")
+    XCTAssertEqual(unexpectedRaises, [Int](repeating: 0, count: threads))
+
+    var count = 0
+    source.invokeAll { _ in count += 1 }
+    XCTAssertEqual(count, subscribed)
+  }
 }
 
 var eventTests: [XCTestCaseEntry] = [
   testCase([
     ("EventsOnInstance", EventTests.testEventsOnInstance),
+    ("SameHandlerAddedTwice", EventTests.testSameHandlerAddedTwice),
     ("StaticEvent", EventTests.testStaticEvent),
     ("SwiftImplementedEventWithWinRTListener", EventTests.testSwiftImplementedEventWithWinRTListener),
     ("SwiftImplementedEventWithSwiftListener", EventTests.testSwiftImplementedEventWithSwiftListener),
+    ("EventSource_handlerRemovedDuringRaiseIsReleased", EventTests.testEventSource_handlerRemovedDuringRaiseIsReleased),
+    ("EventSource_contention", EventTests.testEventSource_contention),
   ])
 ]
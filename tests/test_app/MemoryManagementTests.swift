@@ -51,6 +51,20 @@ class MemoryManagementTests : XCTestCase {
         }()
         XCTAssertNil(weakDerived)
     }
+
+    public func testSwiftImplementationHeldByNative() throws {
+        weak var weakImpl: MyImplementableDelegate? = nil
+        var classy: Class? = nil
+        do {
+            let impl = MyImplementableDelegate()
+            weakImpl = impl
+            classy = Class("with delegate", .orange, impl)
+        }
+        // Only the reference the native object holds is keeping the implementation alive now
+        XCTAssertNotNil(weakImpl)
+        classy = nil
+        XCTAssertNil(weakImpl)
+    }
 }
 
 var memoryManagementTests: [XCTestCaseEntry] = [
@@ -59,5 +73,6 @@ var memoryManagementTests: [XCTestCaseEntry] = [
     ("testNonAggregatedObject", MemoryManagementTests.testNonAggregatedObject),
     ("testReturningAggregatedObject", MemoryManagementTests.testReturningAggregatedObject),
     ("testReturningNonAggregatedObject", MemoryManagementTests.testReturningNonAggregatedObject),
+    ("testSwiftImplementationHeldByNative", MemoryManagementTests.testSwiftImplementationHeldByNative),
   ])
 ]
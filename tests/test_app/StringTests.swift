@@ -58,6 +58,18 @@ class StringTests : XCTestCase {
         }
     }
 
+    // Strings which fit in the stack buffer and ones which don't take different
+    // paths through withHStringRef, check the lengths on either side of it.
+    public func testWithHStringRefLongString() throws {
+        for length in [510, 511, 512, 4096] {
+            let s = String(repeating: "a", count: length - 1) + "😀"
+            s.withHStringRef { hstring in
+                XCTAssertEqual(WindowsGetStringLen(hstring), UInt32(s.utf16.count))
+                XCTAssertEqual(String(from: hstring), s)
+            }
+        }
+    }
+
     // MARK: - StaticString.withHStringRef
 
     // ASCII static strings have equal UTF-8 byte and UTF-16 code unit counts,
@@ -131,6 +143,7 @@ var stringTests: [XCTestCaseEntry] = [
         ("testWithHStringRefEmoji", StringTests.testWithHStringRefEmoji),
         ("testWithHStringRefCombiningCharacter", StringTests.testWithHStringRefCombiningCharacter),
         ("testWithHStringRefEmpty", StringTests.testWithHStringRefEmpty),
+        ("testWithHStringRefLongString", StringTests.testWithHStringRefLongString),
         ("testStaticStringWithHStringRefAscii", StringTests.testStaticStringWithHStringRefAscii),
         ("testStaticStringWithHStringRefNonAscii", StringTests.testStaticStringWithHStringRefNonAscii),
         ("testStaticStringWithHStringRefEmpty", StringTests.testStaticStringWithHStringRefEmpty),
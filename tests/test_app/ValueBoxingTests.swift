@@ -19,6 +19,14 @@ class ValueBoxingTests : XCTestCase {
     XCTAssertEqual("\(value)", result)
   }
 
+  public func testInCachedAndUncachedInts() {
+    // Small values share a box and the rest get one each, both have to look the same from native code
+    let classy = Class()
+    for value: Int32 in [0, -128, 127, 128, -129, .max] {
+      XCTAssertEqual("\(value)", try! classy.inObject(value))
+    }
+  }
+
   public func testInString() {
     let words = "hello world"
     let classy = Class()
@@ -93,18 +101,33 @@ class ValueBoxingTests : XCTestCase {
     anyObj = try! classy.returnObject()
     XCTAssertEqual(anyObj as! Person, person)
   }
+
+  public func testBoxedValuesRoundTrip() {
+    // The native property set holds on to the boxes made on the Swift side, which come back as their values
+    let set = PropertySet()
+    _ = set.insert("small", 7)
+    _ = set.insert("large", 1_000_000)
+    _ = set.insert("flag", true)
+    _ = set.insert("words", "hello")
+    XCTAssertEqual(set.lookup("small") as? Int64, 7)
+    XCTAssertEqual(set.lookup("large") as? Int64, 1_000_000)
+    XCTAssertEqual(set.lookup("flag") as? Bool, true)
+    XCTAssertEqual(set.lookup("words") as? String, "hello")
+  }
 }
 
 
 var valueBoxingTests: [XCTestCaseEntry] = [
   testCase([
     ("InInt", ValueBoxingTests.testInInt),
+    ("InCachedAndUncachedInts", ValueBoxingTests.testInCachedAndUncachedInts),
     ("InString", ValueBoxingTests.testInString),
     ("InWinRTClass", ValueBoxingTests.testInWinRTClass),
     ("InSwiftStruct", ValueBoxingTests.testInSwiftStruct),
     ("OutInterface", ValueBoxingTests.testOutInterface),
     ("testInAppImplemented", ValueBoxingTests.testInAppImplemented),
     ("testInAppImplementedMultipleInterfaces", ValueBoxingTests.testInAppImplementedMultipleInterfaces),
-    ("RoundTripping", ValueBoxingTests.testRoundTripping)
+    ("RoundTripping", ValueBoxingTests.testRoundTripping),
+    ("BoxedValuesRoundTrip", ValueBoxingTests.testBoxedValuesRoundTrip)
   ])
 ]
\ No newline at end of file
@@ -2,6 +2,7 @@ import WinSDK
 import XCTest
 @_spi(WinRTInternal) import test_component
 import Foundation
+import WindowsFoundation
 
 class WeakReferenceTests : XCTestCase {
   class Target: IReferenceTarget {
@@ -22,11 +23,71 @@ class WeakReferenceTests : XCTestCase {
     original = nil
     XCTAssertNil(try weakReferencer.resolve())
   }
+
+  public func testResolveSwiftObject() throws {
+    var original: Target! = Target()
+    let weakReference = try WeakReference(original)
+    XCTAssertIdentical(try weakReference.resolve(), original)
+    original = nil
+    XCTAssertNil(try weakReference.resolve())
+  }
+
+  public func testResolveWinRTObject() throws {
+    var original: Simple! = Simple()
+    original.stringProperty = "weak"
+    let weakReference = try WeakReference(original)
+    XCTAssertEqual(try XCTUnwrap(weakReference.resolve()).stringProperty, "weak")
+    original = nil
+    XCTAssertNil(try weakReference.resolve())
+  }
+
+  public func testResolveWinRTInterface() throws {
+    // the C++ object behind this has no runtime class of its own, so there's no maker for it
+    var input = [AnyIStringable?](repeating: nil, count: 2)
+    try ArrayMethods.refStringableArray(&input)
+    var original: AnyIStringable! = input[0]
+    input = []
+    let weakReference = try WeakReference(original)
+    XCTAssertEqual(try XCTUnwrap(weakReference.resolve()).toString(), "1")
+    original = nil
+    XCTAssertNil(try weakReference.resolve())
+  }
+
+  public func testResolveInLoop() throws {
+    let swiftObject = Target()
+    let winrtObject = Simple()
+    let swiftReference = try WeakReference(swiftObject)
+    let winrtReference = try WeakReference(winrtObject)
+
+    let iterations = 100_000
+    var resolved = 0
+    let clock = ContinuousClock()
+    let swiftTime = try clock.measure {
+      for _ in 0..<iterations {
+        if try swiftReference.resolve() != nil {
+          resolved += 1
+        }
+      }
+    }
+    let winrtTime = try clock.measure {
+      for _ in 0..<iterations {
+        if try winrtReference.resolve() != nil {
+          resolved += 1
+        }
+      }
+    }
+    print("resolving a weak reference \(iterations) times: \(swiftTime) for a Swift object, \(winrtTime) for a WinRT object")
+    XCTAssertEqual(resolved, 2 * iterations)
+  }
 }
 
 var weakReferenceTests: [XCTestCaseEntry] = [
   testCase([
     ("testCreateAndResolve", WeakReferenceTests.testCreateAndResolve),
-    ("testNotStrong", WeakReferenceTests.testNotStrong)
+    ("testNotStrong", WeakReferenceTests.testNotStrong),
+    ("testResolveSwiftObject", WeakReferenceTests.testResolveSwiftObject),
+    ("testResolveWinRTObject", WeakReferenceTests.testResolveWinRTObject),
+    ("testResolveWinRTInterface", WeakReferenceTests.testResolveWinRTInterface),
+    ("testResolveInLoop", WeakReferenceTests.testResolveInLoop)
   ])
 ]
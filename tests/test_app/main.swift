@@ -480,7 +480,7 @@ var tests: [XCTestCaseEntry] = [
 
 // Have to start adding tests in different lines, otherwise we get the following error:
 //  error: the compiler is unable to type-check this expression in reasonable time; try breaking up the expression into distinct sub-expressions
-tests += arrayTests + stringTests
+tests += arrayTests + stringTests + activationFactoryCacheTests
 
 RoInitialize(RO_INIT_MULTITHREADED)
 XCTMain(tests)
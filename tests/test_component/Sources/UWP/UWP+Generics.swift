@@ -2805,11 +2805,10 @@ public class IIteratorString: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [String]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI { _items in
+        try items.fillFromAbi { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1_HSTRING.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abi: _items)
         }
         return result
     }
@@ -2920,9 +2919,7 @@ internal var __x_ABI_C__FIIterator_1___x_ABI_CWindows__CData__CText__CTextSegmen
         guard let __unwrapped__instance = __x_ABI_C__FIIterator_1___x_ABI_CWindows__CData__CText__CTextSegmentWrapper.tryUnwrapFrom(raw: $0) else { return E_INVALIDARG }
         var items: [UWP.TextSegment] = .from(abi: (count: $1, start: $2))
         let result = __unwrapped__instance.getMany(&items)
-        do {
-            try items.fill(abi: $2)
-        } catch { return failWith(error: error) }
+        items.fill(abi: $2)
         $3?.initialize(to: result)
         return S_OK
     }
@@ -3109,11 +3106,10 @@ public class IIteratorIKeyValuePairString_Any: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [WindowsFoundation.AnyIKeyValuePair<String, Any?>?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: UWP.__x_ABI_C__FIKeyValuePair_2_HSTRING_IInspectableBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: UWP.__x_ABI_C__FIKeyValuePair_2_HSTRING_IInspectableBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_C__FIKeyValuePair_2_HSTRING_IInspectable.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: UWP.__x_ABI_C__FIKeyValuePair_2_HSTRING_IInspectableBridge.self, abi: _items)
         }
         return result
     }
@@ -3261,11 +3257,10 @@ public class IIteratorIKeyValuePairString_IVectorViewTextSegment: WindowsFoundat
 
     open func GetMany(_ items: inout [WindowsFoundation.AnyIKeyValuePair<String, WindowsFoundation.AnyIVectorView<UWP.TextSegment>?>?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: UWP.__x_ABI_C__FIKeyValuePair_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegmentBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: UWP.__x_ABI_C__FIKeyValuePair_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegmentBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_C__FIKeyValuePair_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: UWP.__x_ABI_C__FIKeyValuePair_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegmentBridge.self, abi: _items)
         }
         return result
     }
@@ -3413,11 +3408,10 @@ public class IIteratorIStorageItem: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [UWP.AnyIStorageItem?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_Windows_Storage.IStorageItemBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_Windows_Storage.IStorageItemBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_CWindows__CStorage__CIStorageItem.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_Windows_Storage.IStorageItemBridge.self, abi: _items)
         }
         return result
     }
@@ -3717,11 +3711,10 @@ public class IIteratorStorageFile: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [UWP.StorageFile?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_Windows_Storage.StorageFileBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_Windows_Storage.StorageFileBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_CWindows__CStorage__CStorageFile.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_Windows_Storage.StorageFileBridge.self, abi: _items)
         }
         return result
     }
@@ -3868,11 +3861,10 @@ public class IIteratorStorageFolder: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [UWP.StorageFolder?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_Windows_Storage.StorageFolderBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_Windows_Storage.StorageFolderBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_CWindows__CStorage__CStorageFolder.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_Windows_Storage.StorageFolderBridge.self, abi: _items)
         }
         return result
     }
@@ -4019,11 +4011,10 @@ public class IIteratorStorageLibraryChange: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [UWP.StorageLibraryChange?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_Windows_Storage.StorageLibraryChangeBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_Windows_Storage.StorageLibraryChangeBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_CWindows__CStorage__CStorageLibraryChange.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_Windows_Storage.StorageLibraryChangeBridge.self, abi: _items)
         }
         return result
     }
@@ -4170,11 +4161,10 @@ public class IIteratorUser: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [UWP.User?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_Windows_System.UserBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_Windows_System.UserBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_CWindows__CSystem__CUser.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_Windows_System.UserBridge.self, abi: _items)
         }
         return result
     }
@@ -4776,9 +4766,10 @@ public class IMapViewString_Any: WindowsFoundation.IInspectable {
 
     open func Lookup(_ key: String) throws -> Any? {
         let (result) = try ComPtrs.initialize { resultAbi in
-            let _key = try! HString(key)
-            _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_IInspectable.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key.get(), &resultAbi))
+            try key.withHStringRef { _key in
+                _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_IInspectable.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key, &resultAbi))
+                }
             }
         }
         return __ABI_.AnyWrapper.unwrapFrom(abi: result)
@@ -4794,9 +4785,10 @@ public class IMapViewString_Any: WindowsFoundation.IInspectable {
 
     open func HasKey(_ key: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_IInspectable.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_IInspectable.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key, &result))
+            }
         }
         return .init(from: result)
     }
@@ -4943,9 +4935,10 @@ public class IMapViewString_IVectorViewTextSegment: WindowsFoundation.IInspectab
 
     open func Lookup(_ key: String) throws -> WindowsFoundation.AnyIVectorView<UWP.TextSegment>? {
         let (result) = try ComPtrs.initialize { resultAbi in
-            let _key = try! HString(key)
-            _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key.get(), &resultAbi))
+            try key.withHStringRef { _key in
+                _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key, &resultAbi))
+                }
             }
         }
         return UWP.__x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegmentWrapper.unwrapFrom(abi: result)
@@ -4961,9 +4954,10 @@ public class IMapViewString_IVectorViewTextSegment: WindowsFoundation.IInspectab
 
     open func HasKey(_ key: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key, &result))
+            }
         }
         return .init(from: result)
     }
@@ -5128,9 +5122,10 @@ public class IMapString_Any: WindowsFoundation.IInspectable {
 
     open func Lookup(_ key: String) throws -> Any? {
         let (result) = try ComPtrs.initialize { resultAbi in
-            let _key = try! HString(key)
-            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key.get(), &resultAbi))
+            try key.withHStringRef { _key in
+                _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key, &resultAbi))
+                }
             }
         }
         return __ABI_.AnyWrapper.unwrapFrom(abi: result)
@@ -5146,9 +5141,10 @@ public class IMapString_Any: WindowsFoundation.IInspectable {
 
     open func HasKey(_ key: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key, &result))
+            }
         }
         return .init(from: result)
     }
@@ -5164,19 +5160,21 @@ public class IMapString_Any: WindowsFoundation.IInspectable {
 
     open func Insert(_ key: String, _ value: Any?) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        let valueWrapper = __ABI_.AnyWrapper(value)
-        let _value = try! valueWrapper?.toABI { $0 }
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Insert(pThis, _key.get(), _value, &result))
+        try key.withHStringRef { _key in
+            let valueWrapper = __ABI_.AnyWrapper(value)
+            let _value = try! valueWrapper?.toABI { $0 }
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Insert(pThis, _key, _value, &result))
+            }
         }
         return .init(from: result)
     }
 
     open func Remove(_ key: String) throws {
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Remove(pThis, _key.get()))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Remove(pThis, _key))
+            }
         }
     }
 
@@ -5351,9 +5349,10 @@ public class IMapString_IVectorViewTextSegment: WindowsFoundation.IInspectable {
 
     open func Lookup(_ key: String) throws -> WindowsFoundation.AnyIVectorView<UWP.TextSegment>? {
         let (result) = try ComPtrs.initialize { resultAbi in
-            let _key = try! HString(key)
-            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key.get(), &resultAbi))
+            try key.withHStringRef { _key in
+                _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key, &resultAbi))
+                }
             }
         }
         return UWP.__x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegmentWrapper.unwrapFrom(abi: result)
@@ -5369,9 +5368,10 @@ public class IMapString_IVectorViewTextSegment: WindowsFoundation.IInspectable {
 
     open func HasKey(_ key: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key, &result))
+            }
         }
         return .init(from: result)
     }
@@ -5387,19 +5387,21 @@ public class IMapString_IVectorViewTextSegment: WindowsFoundation.IInspectable {
 
     open func Insert(_ key: String, _ value: WindowsFoundation.AnyIVectorView<UWP.TextSegment>?) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        let valueWrapper = UWP.__x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegmentWrapper(value)
-        let _value = try! valueWrapper?.toABI { $0 }
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Insert(pThis, _key.get(), _value, &result))
+        try key.withHStringRef { _key in
+            let valueWrapper = UWP.__x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegmentWrapper(value)
+            let _value = try! valueWrapper?.toABI { $0 }
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Insert(pThis, _key, _value, &result))
+            }
         }
         return .init(from: result)
     }
 
     open func Remove(_ key: String) throws {
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Remove(pThis, _key.get()))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegment.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Remove(pThis, _key))
+            }
         }
     }
 
@@ -5536,7 +5538,7 @@ public class IObservableMapString_Any: WindowsFoundation.IInspectable {
 
     open func add_MapChanged(_ vhnd: MapChangedEventHandler<String, Any?>?) throws -> EventRegistrationToken {
         var result: EventRegistrationToken = .init()
-        let vhndWrapper = UWP.__x_ABI_C__FMapChangedEventHandler_2_HSTRING_IInspectableWrapper(vhnd)
+        let vhndWrapper = WindowsFoundation.__x_ABI_C__FMapChangedEventHandler_2_HSTRING_IInspectableWrapper(vhnd)
         let _vhnd = try! vhndWrapper?.toABI { $0 }
         _ = try perform(as: __x_ABI_C__FIObservableMap_2_HSTRING_IInspectable.self) { pThis in
             try CHECKED(pThis.pointee.lpVtbl.pointee.add_MapChanged(pThis, _vhnd, &result))
@@ -5544,6 +5546,15 @@ public class IObservableMapString_Any: WindowsFoundation.IInspectable {
         return result
     }
 
+    @_spi(WinRTInternal)
+    public func add_MapChanged(_ vhnd: UnsafeMutablePointer<__x_ABI_C__FMapChangedEventHandler_2_HSTRING_IInspectable>?) throws -> EventRegistrationToken {
+        var result: EventRegistrationToken = .init()
+        _ = try perform(as: __x_ABI_C__FIObservableMap_2_HSTRING_IInspectable.self) { pThis in
+            try CHECKED(pThis.pointee.lpVtbl.pointee.add_MapChanged(pThis, vhnd, &result))
+        }
+        return result
+    }
+
     open func remove_MapChanged(_ token: EventRegistrationToken) throws {
         _ = try perform(as: __x_ABI_C__FIObservableMap_2_HSTRING_IInspectable.self) { pThis in
             try CHECKED(pThis.pointee.lpVtbl.pointee.remove_MapChanged(pThis, token))
@@ -5581,12 +5592,13 @@ fileprivate class __x_ABI_C__FIObservableMap_2_HSTRING_IInspectableImpl : IObser
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.foundation.collections.iobservablemap-2.mapchanged)
     fileprivate lazy var mapChanged : Event<MapChangedEventHandler<String, Any?>> = {
       .init(
+        bridge: WindowsFoundation.__x_ABI_C__FMapChangedEventHandler_2_HSTRING_IInspectableBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_MapChanged($0)
+          return try this.add_MapChanged($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_MapChanged($0)
+         try self?._default.remove_MapChanged($0)
        }
       )
     }()
@@ -5729,20 +5741,20 @@ public class IVectorViewString: WindowsFoundation.IInspectable {
 
     open func IndexOf(_ value: String, _ index: inout UInt32) throws -> Bool {
         var result: boolean = 0
-        let _value = try! HString(value)
-        _ = try perform(as: __x_ABI_C__FIVectorView_1_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.IndexOf(pThis, _value.get(), &index, &result))
+        try value.withHStringRef { _value in
+            _ = try perform(as: __x_ABI_C__FIVectorView_1_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.IndexOf(pThis, _value, &index, &result))
+            }
         }
         return .init(from: result)
     }
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [String]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI { _items in
+        try items.fillFromAbi { _items in
             _ = try perform(as: __x_ABI_C__FIVectorView_1_HSTRING.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abi: _items)
         }
         return result
     }
@@ -5787,6 +5799,9 @@ fileprivate class __x_ABI_C__FIVectorView_1_HSTRINGImpl : IVectorView, AbiInterf
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: "")
+    }
 
     subscript(position: Int) -> Element {
         get {
@@ -5886,9 +5901,7 @@ internal var __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTextSegm
         let startIndex: UInt32 = $1
         var items: [UWP.TextSegment] = .from(abi: (count: $2, start: $3))
         let result = __unwrapped__instance.getMany(startIndex, &items)
-        do {
-            try items.fill(abi: $3)
-        } catch { return failWith(error: error) }
+        items.fill(abi: $3)
         $4?.initialize(to: result)
         return S_OK
     }
@@ -5972,6 +5985,9 @@ fileprivate class __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CData__CText__CTex
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: .init())
+    }
 
     subscript(position: Int) -> Element {
         get {
@@ -6110,11 +6126,10 @@ public class IVectorViewIStorageItem: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [UWP.AnyIStorageItem?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_Windows_Storage.IStorageItemBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_Windows_Storage.IStorageItemBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CStorage__CIStorageItem.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_Windows_Storage.IStorageItemBridge.self, abi: _items)
         }
         return result
     }
@@ -6159,6 +6174,9 @@ fileprivate class __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CStorage__CIStorag
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
     subscript(position: Int) -> Element {
         get {
@@ -6481,11 +6499,10 @@ public class IVectorViewStorageFile: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [UWP.StorageFile?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_Windows_Storage.StorageFileBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_Windows_Storage.StorageFileBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CStorage__CStorageFile.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_Windows_Storage.StorageFileBridge.self, abi: _items)
         }
         return result
     }
@@ -6530,6 +6547,9 @@ fileprivate class __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CStorage__CStorage
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
     subscript(position: Int) -> Element {
         get {
@@ -6665,11 +6685,10 @@ public class IVectorViewStorageFolder: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [UWP.StorageFolder?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_Windows_Storage.StorageFolderBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_Windows_Storage.StorageFolderBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CStorage__CStorageFolder.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_Windows_Storage.StorageFolderBridge.self, abi: _items)
         }
         return result
     }
@@ -6714,6 +6733,9 @@ fileprivate class __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CStorage__CStorage
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
     subscript(position: Int) -> Element {
         get {
@@ -6849,11 +6871,10 @@ public class IVectorViewStorageLibraryChange: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [UWP.StorageLibraryChange?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_Windows_Storage.StorageLibraryChangeBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_Windows_Storage.StorageLibraryChangeBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CStorage__CStorageLibraryChange.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_Windows_Storage.StorageLibraryChangeBridge.self, abi: _items)
         }
         return result
     }
@@ -6898,6 +6919,9 @@ fileprivate class __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CStorage__CStorage
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
     subscript(position: Int) -> Element {
         get {
@@ -7033,11 +7057,10 @@ public class IVectorViewUser: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [UWP.User?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_Windows_System.UserBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_Windows_System.UserBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CSystem__CUser.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_Windows_System.UserBridge.self, abi: _items)
         }
         return result
     }
@@ -7082,6 +7105,9 @@ fileprivate class __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CSystem__CUserImpl
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
     subscript(position: Int) -> Element {
         get {
@@ -7264,6 +7290,9 @@ fileprivate class __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CSystem__CUserWatc
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: .init(0))
+    }
 
     subscript(position: Int) -> Element {
         get {
@@ -7459,24 +7488,27 @@ public class IVectorString: WindowsFoundation.IInspectable {
 
     open func IndexOf(_ value: String, _ index: inout UInt32) throws -> Bool {
         var result: boolean = 0
-        let _value = try! HString(value)
-        _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.IndexOf(pThis, _value.get(), &index, &result))
+        try value.withHStringRef { _value in
+            _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.IndexOf(pThis, _value, &index, &result))
+            }
         }
         return .init(from: result)
     }
 
     open func SetAt(_ index: UInt32, _ value: String) throws {
-        let _value = try! HString(value)
-        _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.SetAt(pThis, index, _value.get()))
+        try value.withHStringRef { _value in
+            _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.SetAt(pThis, index, _value))
+            }
         }
     }
 
     open func InsertAt(_ index: UInt32, _ value: String) throws {
-        let _value = try! HString(value)
-        _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.InsertAt(pThis, index, _value.get()))
+        try value.withHStringRef { _value in
+            _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.InsertAt(pThis, index, _value))
+            }
         }
     }
 
@@ -7487,9 +7519,10 @@ public class IVectorString: WindowsFoundation.IInspectable {
     }
 
     open func Append(_ value: String) throws {
-        let _value = try! HString(value)
-        _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Append(pThis, _value.get()))
+        try value.withHStringRef { _value in
+            _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Append(pThis, _value))
+            }
         }
     }
 
@@ -7507,11 +7540,10 @@ public class IVectorString: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [String]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI { _items in
+        try items.fillFromAbi { _items in
             _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abi: _items)
         }
         return result
     }
@@ -7564,6 +7596,9 @@ fileprivate class __x_ABI_C__FIVector_1_HSTRINGImpl : IVector, AbiInterfaceImpl
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: "")
+    }
 
 
     subscript(position: Int) -> Element {
@@ -0,0 +1,114 @@
+// WARNING: Please don't edit this file. It was generated by Swift/WinRT v0.0.1
+// swiftlint:disable all
+import Foundation
+@_spi(WinRTInternal) @_spi(WinRTImplements) import WindowsFoundation
+import CWinRT
+
+@_spi(WinRTInternal)
+public final class __MakerTable: MakerTable {
+    public static let seeds: [UInt32] = [
+        0, 7, 0, 1, 0, 1, 1, 0, 3, 5, 2, 1, 3, 1, 2, 2,
+        0, 0, 2, 0, 9, 0, 2, 0, 0, 0, 3, 1, 0, 0, 0, 4,
+        5, 4, 0, 0, 23, 3, 18, 6, 1, 5, 100, 2, 64, 0, 11, 0,
+    ]
+    public static let names: [String] = [
+        "Windows.Storage.IStorageItemProperties2",
+        "Windows.System.UserAuthenticationStatusChangingEventArgs",
+        "Windows.System.User",
+        "Windows.Storage.IStorageFile2",
+        "Windows.Storage.Streams.IRandomAccessStreamWithContentType",
+        "Windows.Storage.Streams.IRandomAccessStreamReference",
+        "Windows.Storage.StorageFolder",
+        "Windows.Storage.StorageLibraryChangeReader",
+        "Windows.Storage.StorageLibraryChangeTracker",
+        "Windows.Storage.IStorageFolder",
+        "Windows.Storage.IStorageItemProperties",
+        "Windows.Storage.Streams.IRandomAccessStream",
+        "Windows.Storage.IStorageFile",
+        "Windows.Storage.FileProperties.VideoProperties",
+        "Windows.System.UserWatcher",
+        "Windows.Storage.Search.QueryOptions",
+        "Windows.Storage.StreamedFileDataRequest",
+        "Windows.Storage.IStorageFolder2",
+        "Windows.Storage.StorageLibraryChange",
+        "Windows.Storage.StorageProvider",
+        "Windows.Storage.Search.StorageFolderQueryResult",
+        "Windows.Storage.Search.StorageFileQueryResult",
+        "Windows.System.UserChangedEventArgs",
+        "Windows.Storage.Search.StorageItemQueryResult",
+        "Windows.Storage.StorageStreamTransaction",
+        "Windows.Storage.Streams.IInputStreamReference",
+        "Windows.Storage.FileProperties.MusicProperties",
+        "Windows.Storage.FileProperties.StorageItemContentProperties",
+        "Windows.Storage.Search.IStorageFolderQueryOperations",
+        "Windows.Storage.StorageFile",
+        "Windows.Storage.FileProperties.DocumentProperties",
+        "Windows.Storage.IStorageItem",
+        "Windows.Storage.IStorageItem2",
+        "Windows.Storage.IStorageItemPropertiesWithProvider",
+        "Windows.Storage.Streams.IBuffer",
+        "Windows.Storage.FileProperties.ImageProperties",
+        "Windows.Storage.IStreamedFileDataRequest",
+        "Windows.Storage.StorageLibraryChangeTrackerOptions",
+        "Windows.Storage.FileProperties.IStorageItemExtraProperties",
+        "Windows.Storage.Streams.IInputStream",
+        "Windows.Storage.Streams.IOutputStream",
+        "Windows.Storage.IStorageFilePropertiesWithAvailability",
+        "Windows.Storage.Streams.IContentTypeProvider",
+        "Windows.Storage.FileProperties.StorageItemThumbnail",
+        "Windows.Storage.FileProperties.BasicProperties",
+        "Windows.Storage.Search.IStorageQueryResultBase",
+        "Windows.System.UserAuthenticationStatusChangeDeferral",
+        "Windows.Storage.Streams.Buffer",
+    ]
+    public static let makers: [any MakeFromAbi.Type] = [
+        IStorageItemProperties2Maker.self,
+        UserAuthenticationStatusChangingEventArgsMaker.self,
+        UserMaker.self,
+        IStorageFile2Maker.self,
+        IRandomAccessStreamWithContentTypeMaker.self,
+        IRandomAccessStreamReferenceMaker.self,
+        StorageFolderMaker.self,
+        StorageLibraryChangeReaderMaker.self,
+        StorageLibraryChangeTrackerMaker.self,
+        IStorageFolderMaker.self,
+        IStorageItemPropertiesMaker.self,
+        IRandomAccessStreamMaker.self,
+        IStorageFileMaker.self,
+        VideoPropertiesMaker.self,
+        UserWatcherMaker.self,
+        QueryOptionsMaker.self,
+        StreamedFileDataRequestMaker.self,
+        IStorageFolder2Maker.self,
+        StorageLibraryChangeMaker.self,
+        StorageProviderMaker.self,
+        StorageFolderQueryResultMaker.self,
+        StorageFileQueryResultMaker.self,
+        UserChangedEventArgsMaker.self,
+        StorageItemQueryResultMaker.self,
+        StorageStreamTransactionMaker.self,
+        IInputStreamReferenceMaker.self,
+        MusicPropertiesMaker.self,
+        StorageItemContentPropertiesMaker.self,
+        IStorageFolderQueryOperationsMaker.self,
+        StorageFileMaker.self,
+        DocumentPropertiesMaker.self,
+        IStorageItemMaker.self,
+        IStorageItem2Maker.self,
+        IStorageItemPropertiesWithProviderMaker.self,
+        IBufferMaker.self,
+        ImagePropertiesMaker.self,
+        IStreamedFileDataRequestMaker.self,
+        StorageLibraryChangeTrackerOptionsMaker.self,
+        IStorageItemExtraPropertiesMaker.self,
+        IInputStreamMaker.self,
+        IOutputStreamMaker.self,
+        IStorageFilePropertiesWithAvailabilityMaker.self,
+        IContentTypeProviderMaker.self,
+        StorageItemThumbnailMaker.self,
+        BasicPropertiesMaker.self,
+        IStorageQueryResultBaseMaker.self,
+        UserAuthenticationStatusChangeDeferralMaker.self,
+        BufferMaker.self,
+    ]
+}
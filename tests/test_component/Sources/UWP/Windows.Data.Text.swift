@@ -25,15 +25,30 @@ public struct TextSegment: Hashable, Codable, Sendable {
 extension TextSegment: WinRTBridgeable {
     public typealias ABI = __x_ABI_CWindows_CData_CText_CTextSegment
     public static func from(abi: ABI) -> Self {
-        .init(startPosition: abi.StartPosition, length: abi.Length)
+        guard hasAbiLayout else {
+            return .init(startPosition: abi.StartPosition, length: abi.Length)
+        }
+        return copy(fromABI: abi)
     }
     public func toABI() -> ABI {
         .from(swift: self)
     }
 }
 
+@_spi(WinRTInternal)
+extension TextSegment: WinRTBlittableStruct {
+    public static var hasAbiLayout: Bool {
+        MemoryLayout<Self>.stride == MemoryLayout<ABI>.stride &&
+            MemoryLayout<Self>.offset(of: \.startPosition) == MemoryLayout<ABI>.offset(of: \.StartPosition) &&
+            MemoryLayout<Self>.offset(of: \.length) == MemoryLayout<ABI>.offset(of: \.Length)
+    }
+}
+
 extension __x_ABI_CWindows_CData_CText_CTextSegment {
     public static func from(swift: UWP.TextSegment) -> __x_ABI_CWindows_CData_CText_CTextSegment {
-        .init(StartPosition: swift.startPosition, Length: swift.length)
+        guard UWP.TextSegment.hasAbiLayout else {
+            return .init(StartPosition: swift.startPosition, Length: swift.length)
+        }
+        return swift.copyToABI()
     }
 }
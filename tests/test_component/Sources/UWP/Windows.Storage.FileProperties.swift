@@ -165,12 +165,15 @@ public protocol IStorageItemExtraProperties : WinRTInterface {
 
 extension IStorageItemExtraProperties {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage_FileProperties.IStorageItemExtraPropertiesWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_FileProperties.IStorageItemExtraPropertiesWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0xC54361B2:
+                if iid == __ABI_Windows_Storage_FileProperties.IStorageItemExtraPropertiesWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_FileProperties.IStorageItemExtraPropertiesWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageItemExtraProperties = any IStorageItemExtraProperties
@@ -566,9 +569,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_Title(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIDocumentProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Title(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIDocumentProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Title(pThis, _value))
+                }
             }
         }
 
@@ -591,9 +595,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_Comment(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIDocumentProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Comment(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIDocumentProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Comment(pThis, _value))
+                }
             }
         }
 
@@ -803,9 +808,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_Title(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIImageProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Title(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIImageProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Title(pThis, _value))
+                }
             }
         }
 
@@ -837,9 +843,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_CameraManufacturer(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIImageProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_CameraManufacturer(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIImageProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_CameraManufacturer(pThis, _value))
+                }
             }
         }
 
@@ -853,9 +860,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_CameraModel(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIImageProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_CameraModel(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIImageProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_CameraModel(pThis, _value))
+                }
             }
         }
 
@@ -1053,9 +1061,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_Album(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIMusicProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Album(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIMusicProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Album(pThis, _value))
+                }
             }
         }
 
@@ -1069,9 +1078,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_Artist(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIMusicProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Artist(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIMusicProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Artist(pThis, _value))
+                }
             }
         }
 
@@ -1108,9 +1118,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_Title(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIMusicProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Title(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIMusicProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Title(pThis, _value))
+                }
             }
         }
 
@@ -1154,9 +1165,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_AlbumArtist(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIMusicProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_AlbumArtist(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIMusicProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_AlbumArtist(pThis, _value))
+                }
             }
         }
 
@@ -1188,9 +1200,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_Subtitle(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIMusicProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Subtitle(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIMusicProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Subtitle(pThis, _value))
+                }
             }
         }
 
@@ -1213,9 +1226,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_Publisher(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIMusicProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Publisher(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIMusicProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Publisher(pThis, _value))
+                }
             }
         }
 
@@ -1805,9 +1819,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_Title(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIVideoProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Title(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIVideoProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Title(pThis, _value))
+                }
             }
         }
 
@@ -1821,9 +1836,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_Subtitle(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIVideoProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Subtitle(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIVideoProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Subtitle(pThis, _value))
+                }
             }
         }
 
@@ -1846,9 +1862,10 @@ extension __ABI_Windows_Storage_FileProperties {
         }
 
         public func put_Publisher(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIVideoProperties.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Publisher(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CFileProperties_CIVideoProperties.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Publisher(pThis, _value))
+                }
             }
         }
 
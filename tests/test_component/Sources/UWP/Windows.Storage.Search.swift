@@ -245,12 +245,15 @@ public protocol IStorageFolderQueryOperations : WinRTInterface {
 
 extension IStorageFolderQueryOperations {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage_Search.IStorageFolderQueryOperationsWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Search.IStorageFolderQueryOperationsWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0xCB43CCC9:
+                if iid == __ABI_Windows_Storage_Search.IStorageFolderQueryOperationsWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Search.IStorageFolderQueryOperationsWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageFolderQueryOperations = any IStorageFolderQueryOperations
@@ -769,12 +772,15 @@ public protocol IStorageQueryResultBase : WinRTInterface {
 
 extension IStorageQueryResultBase {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage_Search.IStorageQueryResultBaseWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Search.IStorageQueryResultBaseWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0xC297D70D:
+                if iid == __ABI_Windows_Storage_Search.IStorageQueryResultBaseWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Search.IStorageQueryResultBaseWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageQueryResultBase = any IStorageQueryResultBase
@@ -834,12 +840,13 @@ extension __IMPL_Windows_Storage_Search {
         /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.storage.search.istoragequeryresultbase.contentschanged)
         fileprivate lazy var contentsChanged : Event<TypedEventHandler<IStorageQueryResultBase?, Any?>> = {
           .init(
+            bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CStorage__CSearch__CIStorageQueryResultBase_IInspectableBridge.self,
             add: { [weak self] in
               guard let this = self?._default else { return .init() }
-              return try! this.add_ContentsChanged($0)
+              return try this.add_ContentsChanged($0)
             },
             remove: { [weak self] in
-             try? self?._default.remove_ContentsChanged($0)
+             try self?._default.remove_ContentsChanged($0)
            }
           )
         }()
@@ -847,12 +854,13 @@ extension __IMPL_Windows_Storage_Search {
         /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.storage.search.istoragequeryresultbase.optionschanged)
         fileprivate lazy var optionsChanged : Event<TypedEventHandler<IStorageQueryResultBase?, Any?>> = {
           .init(
+            bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CStorage__CSearch__CIStorageQueryResultBase_IInspectableBridge.self,
             add: { [weak self] in
               guard let this = self?._default else { return .init() }
-              return try! this.add_OptionsChanged($0)
+              return try this.add_OptionsChanged($0)
             },
             remove: { [weak self] in
-             try? self?._default.remove_OptionsChanged($0)
+             try self?._default.remove_OptionsChanged($0)
            }
           )
         }()
@@ -897,6 +905,15 @@ extension __ABI_Windows_Storage_Search {
             return eventCookie
         }
 
+        @_spi(WinRTInternal)
+        public func add_ContentsChanged(_ handler: UnsafeMutablePointer<__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CStorage__CSearch__CIStorageQueryResultBase_IInspectable>?) throws -> EventRegistrationToken {
+            var eventCookie: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_CWindows_CStorage_CSearch_CIStorageQueryResultBase.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_ContentsChanged(pThis, handler, &eventCookie))
+            }
+            return eventCookie
+        }
+
         open func remove_ContentsChanged(_ eventCookie: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_CWindows_CStorage_CSearch_CIStorageQueryResultBase.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_ContentsChanged(pThis, eventCookie))
@@ -913,6 +930,15 @@ extension __ABI_Windows_Storage_Search {
             return eventCookie
         }
 
+        @_spi(WinRTInternal)
+        public func add_OptionsChanged(_ changedHandler: UnsafeMutablePointer<__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CStorage__CSearch__CIStorageQueryResultBase_IInspectable>?) throws -> EventRegistrationToken {
+            var eventCookie: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_CWindows_CStorage_CSearch_CIStorageQueryResultBase.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_OptionsChanged(pThis, changedHandler, &eventCookie))
+            }
+            return eventCookie
+        }
+
         open func remove_OptionsChanged(_ eventCookie: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_CWindows_CStorage_CSearch_CIStorageQueryResultBase.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_OptionsChanged(pThis, eventCookie))
@@ -1241,9 +1267,10 @@ extension __ABI_Windows_Storage_Search {
         }
 
         public func put_ApplicationSearchFilter(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CSearch_CIQueryOptions.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_ApplicationSearchFilter(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CSearch_CIQueryOptions.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_ApplicationSearchFilter(pThis, _value))
+                }
             }
         }
 
@@ -1257,9 +1284,10 @@ extension __ABI_Windows_Storage_Search {
         }
 
         public func put_UserSearchFilter(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CSearch_CIQueryOptions.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_UserSearchFilter(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CSearch_CIQueryOptions.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_UserSearchFilter(pThis, _value))
+                }
             }
         }
 
@@ -1273,9 +1301,10 @@ extension __ABI_Windows_Storage_Search {
         }
 
         public func put_Language(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CSearch_CIQueryOptions.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Language(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CSearch_CIQueryOptions.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Language(pThis, _value))
+                }
             }
         }
 
@@ -1329,9 +1358,10 @@ extension __ABI_Windows_Storage_Search {
         }
 
         public func LoadFromString(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_CWindows_CStorage_CSearch_CIQueryOptions.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.LoadFromString(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_CWindows_CStorage_CSearch_CIQueryOptions.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.LoadFromString(pThis, _value))
+                }
             }
         }
 
@@ -1451,12 +1481,13 @@ public final class StorageFileQueryResult : WinRTClass, IStorageQueryResultBase
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.storage.search.storagefilequeryresult.contentschanged)
     public lazy var contentsChanged : Event<TypedEventHandler<IStorageQueryResultBase?, Any?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CStorage__CSearch__CIStorageQueryResultBase_IInspectableBridge.self,
         add: { [weak self] in
           guard let this = self?._IStorageQueryResultBase else { return .init() }
-          return try! this.add_ContentsChanged($0)
+          return try this.add_ContentsChanged($0)
         },
         remove: { [weak self] in
-         try? self?._IStorageQueryResultBase.remove_ContentsChanged($0)
+         try self?._IStorageQueryResultBase.remove_ContentsChanged($0)
        }
       )
     }()
@@ -1464,12 +1495,13 @@ public final class StorageFileQueryResult : WinRTClass, IStorageQueryResultBase
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.storage.search.storagefilequeryresult.optionschanged)
     public lazy var optionsChanged : Event<TypedEventHandler<IStorageQueryResultBase?, Any?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CStorage__CSearch__CIStorageQueryResultBase_IInspectableBridge.self,
         add: { [weak self] in
           guard let this = self?._IStorageQueryResultBase else { return .init() }
-          return try! this.add_OptionsChanged($0)
+          return try this.add_OptionsChanged($0)
         },
         remove: { [weak self] in
-         try? self?._IStorageQueryResultBase.remove_OptionsChanged($0)
+         try self?._IStorageQueryResultBase.remove_OptionsChanged($0)
        }
       )
     }()
@@ -1618,12 +1650,13 @@ public final class StorageFolderQueryResult : WinRTClass, IStorageQueryResultBas
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.storage.search.storagefolderqueryresult.contentschanged)
     public lazy var contentsChanged : Event<TypedEventHandler<IStorageQueryResultBase?, Any?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CStorage__CSearch__CIStorageQueryResultBase_IInspectableBridge.self,
         add: { [weak self] in
           guard let this = self?._IStorageQueryResultBase else { return .init() }
-          return try! this.add_ContentsChanged($0)
+          return try this.add_ContentsChanged($0)
         },
         remove: { [weak self] in
-         try? self?._IStorageQueryResultBase.remove_ContentsChanged($0)
+         try self?._IStorageQueryResultBase.remove_ContentsChanged($0)
        }
       )
     }()
@@ -1631,12 +1664,13 @@ public final class StorageFolderQueryResult : WinRTClass, IStorageQueryResultBas
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.storage.search.storagefolderqueryresult.optionschanged)
     public lazy var optionsChanged : Event<TypedEventHandler<IStorageQueryResultBase?, Any?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CStorage__CSearch__CIStorageQueryResultBase_IInspectableBridge.self,
         add: { [weak self] in
           guard let this = self?._IStorageQueryResultBase else { return .init() }
-          return try! this.add_OptionsChanged($0)
+          return try this.add_OptionsChanged($0)
         },
         remove: { [weak self] in
-         try? self?._IStorageQueryResultBase.remove_OptionsChanged($0)
+         try self?._IStorageQueryResultBase.remove_OptionsChanged($0)
        }
       )
     }()
@@ -1760,12 +1794,13 @@ public final class StorageItemQueryResult : WinRTClass, IStorageQueryResultBase
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.storage.search.storageitemqueryresult.contentschanged)
     public lazy var contentsChanged : Event<TypedEventHandler<IStorageQueryResultBase?, Any?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CStorage__CSearch__CIStorageQueryResultBase_IInspectableBridge.self,
         add: { [weak self] in
           guard let this = self?._IStorageQueryResultBase else { return .init() }
-          return try! this.add_ContentsChanged($0)
+          return try this.add_ContentsChanged($0)
         },
         remove: { [weak self] in
-         try? self?._IStorageQueryResultBase.remove_ContentsChanged($0)
+         try self?._IStorageQueryResultBase.remove_ContentsChanged($0)
        }
       )
     }()
@@ -1773,12 +1808,13 @@ public final class StorageItemQueryResult : WinRTClass, IStorageQueryResultBase
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.storage.search.storageitemqueryresult.optionschanged)
     public lazy var optionsChanged : Event<TypedEventHandler<IStorageQueryResultBase?, Any?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CStorage__CSearch__CIStorageQueryResultBase_IInspectableBridge.self,
         add: { [weak self] in
           guard let this = self?._IStorageQueryResultBase else { return .init() }
-          return try! this.add_OptionsChanged($0)
+          return try this.add_OptionsChanged($0)
         },
         remove: { [weak self] in
-         try? self?._IStorageQueryResultBase.remove_OptionsChanged($0)
+         try self?._IStorageQueryResultBase.remove_OptionsChanged($0)
        }
       )
     }()
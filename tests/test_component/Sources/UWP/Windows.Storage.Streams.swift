@@ -52,15 +52,20 @@ public protocol IBuffer : IBufferByteAccess {
 
 extension IBuffer {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage_Streams.IBufferWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IBufferWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_.IBufferByteAccessWrapper.IID:
-                let wrapper = __ABI_.IBufferByteAccessWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x905A0FE0:
+                if iid == __ABI_Windows_Storage_Streams.IBufferWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IBufferWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x905A0FEF:
+                if iid == __ABI_.IBufferByteAccessWrapper.IID {
+                    let wrapper = __ABI_.IBufferByteAccessWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 extension IBuffer {
@@ -223,12 +228,15 @@ public protocol IContentTypeProvider : WinRTInterface {
 
 extension IContentTypeProvider {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage_Streams.IContentTypeProviderWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IContentTypeProviderWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x97D098A5:
+                if iid == __ABI_Windows_Storage_Streams.IContentTypeProviderWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IContentTypeProviderWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIContentTypeProvider = any IContentTypeProvider
@@ -344,15 +352,20 @@ public protocol IInputStream : WindowsFoundation.IClosable {
 
 extension IInputStream {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage_Streams.IInputStreamWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IInputStreamWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Foundation.IClosableWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x30D5A829:
+                if iid == __ABI_Windows_Foundation.IClosableWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x905A0FE2:
+                if iid == __ABI_Windows_Storage_Streams.IInputStreamWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IInputStreamWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIInputStream = any IInputStream
@@ -483,12 +496,15 @@ public protocol IInputStreamReference : WinRTInterface {
 
 extension IInputStreamReference {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage_Streams.IInputStreamReferenceWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IInputStreamReferenceWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x43929D18:
+                if iid == __ABI_Windows_Storage_Streams.IInputStreamReferenceWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IInputStreamReferenceWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIInputStreamReference = any IInputStreamReference
@@ -609,15 +625,20 @@ public protocol IOutputStream : WindowsFoundation.IClosable {
 
 extension IOutputStream {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage_Streams.IOutputStreamWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IOutputStreamWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Foundation.IClosableWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x30D5A829:
+                if iid == __ABI_Windows_Foundation.IClosableWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x905A0FE6:
+                if iid == __ABI_Windows_Storage_Streams.IOutputStreamWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IOutputStreamWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIOutputStream = any IOutputStream
@@ -784,21 +805,30 @@ public protocol IRandomAccessStream : WindowsFoundation.IClosable, IInputStream,
 
 extension IRandomAccessStream {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage_Streams.IRandomAccessStreamWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Foundation.IClosableWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage_Streams.IInputStreamWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IInputStreamWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage_Streams.IOutputStreamWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IOutputStreamWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x30D5A829:
+                if iid == __ABI_Windows_Foundation.IClosableWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x905A0FE1:
+                if iid == __ABI_Windows_Storage_Streams.IRandomAccessStreamWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x905A0FE2:
+                if iid == __ABI_Windows_Storage_Streams.IInputStreamWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IInputStreamWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x905A0FE6:
+                if iid == __ABI_Windows_Storage_Streams.IOutputStreamWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IOutputStreamWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIRandomAccessStream = any IRandomAccessStream
@@ -1107,12 +1137,15 @@ public protocol IRandomAccessStreamReference : WinRTInterface {
 
 extension IRandomAccessStreamReference {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage_Streams.IRandomAccessStreamReferenceWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamReferenceWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x33EE3134:
+                if iid == __ABI_Windows_Storage_Streams.IRandomAccessStreamReferenceWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamReferenceWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIRandomAccessStreamReference = any IRandomAccessStreamReference
@@ -1229,27 +1262,40 @@ public protocol IRandomAccessStreamWithContentType : WindowsFoundation.IClosable
 
 extension IRandomAccessStreamWithContentType {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage_Streams.IRandomAccessStreamWithContentTypeWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamWithContentTypeWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Foundation.IClosableWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage_Streams.IInputStreamWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IInputStreamWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage_Streams.IOutputStreamWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IOutputStreamWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage_Streams.IRandomAccessStreamWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage_Streams.IContentTypeProviderWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IContentTypeProviderWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x30D5A829:
+                if iid == __ABI_Windows_Foundation.IClosableWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x905A0FE1:
+                if iid == __ABI_Windows_Storage_Streams.IRandomAccessStreamWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x905A0FE2:
+                if iid == __ABI_Windows_Storage_Streams.IInputStreamWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IInputStreamWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x905A0FE6:
+                if iid == __ABI_Windows_Storage_Streams.IOutputStreamWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IOutputStreamWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x97D098A5:
+                if iid == __ABI_Windows_Storage_Streams.IContentTypeProviderWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IContentTypeProviderWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0xCC254827:
+                if iid == __ABI_Windows_Storage_Streams.IRandomAccessStreamWithContentTypeWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamWithContentTypeWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIRandomAccessStreamWithContentType = any IRandomAccessStreamWithContentType
@@ -288,21 +288,30 @@ public protocol IStorageFile : IStorageItem, UWP.IRandomAccessStreamReference, U
 
 extension IStorageFile {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage.IStorageFileWrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageFileWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage.IStorageItemWrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageItemWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage_Streams.IRandomAccessStreamReferenceWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamReferenceWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage_Streams.IInputStreamReferenceWrapper.IID:
-                let wrapper = __ABI_Windows_Storage_Streams.IInputStreamReferenceWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x33EE3134:
+                if iid == __ABI_Windows_Storage_Streams.IRandomAccessStreamReferenceWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamReferenceWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x4207A996:
+                if iid == __ABI_Windows_Storage.IStorageItemWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageItemWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x43929D18:
+                if iid == __ABI_Windows_Storage_Streams.IInputStreamReferenceWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage_Streams.IInputStreamReferenceWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0xFA3F6186:
+                if iid == __ABI_Windows_Storage.IStorageFileWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageFileWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageFile = any IStorageFile
@@ -520,9 +529,10 @@ extension __ABI_Windows_Storage {
             let (operation) = try ComPtrs.initialize { operationAbi in
                 let destinationFolderWrapper = __ABI_Windows_Storage.IStorageFolderWrapper(destinationFolder)
                 let _destinationFolder = try! destinationFolderWrapper?.toABI { $0 }
-                let _desiredNewName = try! HString(desiredNewName)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFile.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CopyOverloadDefaultOptions(pThis, _destinationFolder, _desiredNewName.get(), &operationAbi))
+                try desiredNewName.withHStringRef { _desiredNewName in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFile.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CopyOverloadDefaultOptions(pThis, _destinationFolder, _desiredNewName, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFileWrapper.unwrapFrom(abi: operation)
@@ -532,9 +542,10 @@ extension __ABI_Windows_Storage {
             let (operation) = try ComPtrs.initialize { operationAbi in
                 let destinationFolderWrapper = __ABI_Windows_Storage.IStorageFolderWrapper(destinationFolder)
                 let _destinationFolder = try! destinationFolderWrapper?.toABI { $0 }
-                let _desiredNewName = try! HString(desiredNewName)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFile.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CopyOverload(pThis, _destinationFolder, _desiredNewName.get(), option, &operationAbi))
+                try desiredNewName.withHStringRef { _desiredNewName in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFile.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CopyOverload(pThis, _destinationFolder, _desiredNewName, option, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFileWrapper.unwrapFrom(abi: operation)
@@ -566,9 +577,10 @@ extension __ABI_Windows_Storage {
             let (operation) = try ComPtrs.initialize { operationAbi in
                 let destinationFolderWrapper = __ABI_Windows_Storage.IStorageFolderWrapper(destinationFolder)
                 let _destinationFolder = try! destinationFolderWrapper?.toABI { $0 }
-                let _desiredNewName = try! HString(desiredNewName)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFile.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.MoveOverloadDefaultOptions(pThis, _destinationFolder, _desiredNewName.get(), &operationAbi))
+                try desiredNewName.withHStringRef { _desiredNewName in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFile.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.MoveOverloadDefaultOptions(pThis, _destinationFolder, _desiredNewName, &operationAbi))
+                    }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: operation)
@@ -578,9 +590,10 @@ extension __ABI_Windows_Storage {
             let (operation) = try ComPtrs.initialize { operationAbi in
                 let destinationFolderWrapper = __ABI_Windows_Storage.IStorageFolderWrapper(destinationFolder)
                 let _destinationFolder = try! destinationFolderWrapper?.toABI { $0 }
-                let _desiredNewName = try! HString(desiredNewName)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFile.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.MoveOverload(pThis, _destinationFolder, _desiredNewName.get(), option, &operationAbi))
+                try desiredNewName.withHStringRef { _desiredNewName in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFile.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.MoveOverload(pThis, _destinationFolder, _desiredNewName, option, &operationAbi))
+                    }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: operation)
@@ -782,12 +795,15 @@ public protocol IStorageFile2 : WinRTInterface {
 
 extension IStorageFile2 {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage.IStorageFile2Wrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageFile2Wrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x954E4BCF:
+                if iid == __ABI_Windows_Storage.IStorageFile2Wrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageFile2Wrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageFile2 = any IStorageFile2
@@ -933,12 +949,15 @@ public protocol IStorageFilePropertiesWithAvailability : WinRTInterface {
 
 extension IStorageFilePropertiesWithAvailability {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage.IStorageFilePropertiesWithAvailabilityWrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageFilePropertiesWithAvailabilityWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0xAFCBBE9B:
+                if iid == __ABI_Windows_Storage.IStorageFilePropertiesWithAvailabilityWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageFilePropertiesWithAvailabilityWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageFilePropertiesWithAvailability = any IStorageFilePropertiesWithAvailability
@@ -1071,15 +1090,20 @@ public protocol IStorageFolder : IStorageItem {
 
 extension IStorageFolder {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage.IStorageFolderWrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageFolderWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage.IStorageItemWrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageItemWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x4207A996:
+                if iid == __ABI_Windows_Storage.IStorageItemWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageItemWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x72D1CB78:
+                if iid == __ABI_Windows_Storage.IStorageFolderWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageFolderWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageFolder = any IStorageFolder
@@ -1226,9 +1250,10 @@ extension __ABI_Windows_Storage {
 
         open func CreateFileAsyncOverloadDefaultOptions(_ desiredName: String) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.StorageFile?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _desiredName = try! HString(desiredName)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFileAsyncOverloadDefaultOptions(pThis, _desiredName.get(), &operationAbi))
+                try desiredName.withHStringRef { _desiredName in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFileAsyncOverloadDefaultOptions(pThis, _desiredName, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFileWrapper.unwrapFrom(abi: operation)
@@ -1236,9 +1261,10 @@ extension __ABI_Windows_Storage {
 
         open func CreateFileAsync(_ desiredName: String, _ options: UWP.CreationCollisionOption) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.StorageFile?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _desiredName = try! HString(desiredName)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFileAsync(pThis, _desiredName.get(), options, &operationAbi))
+                try desiredName.withHStringRef { _desiredName in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFileAsync(pThis, _desiredName, options, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFileWrapper.unwrapFrom(abi: operation)
@@ -1246,9 +1272,10 @@ extension __ABI_Windows_Storage {
 
         open func CreateFolderAsyncOverloadDefaultOptions(_ desiredName: String) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.StorageFolder?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _desiredName = try! HString(desiredName)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFolderAsyncOverloadDefaultOptions(pThis, _desiredName.get(), &operationAbi))
+                try desiredName.withHStringRef { _desiredName in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFolderAsyncOverloadDefaultOptions(pThis, _desiredName, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFolderWrapper.unwrapFrom(abi: operation)
@@ -1256,9 +1283,10 @@ extension __ABI_Windows_Storage {
 
         open func CreateFolderAsync(_ desiredName: String, _ options: UWP.CreationCollisionOption) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.StorageFolder?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _desiredName = try! HString(desiredName)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFolderAsync(pThis, _desiredName.get(), options, &operationAbi))
+                try desiredName.withHStringRef { _desiredName in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFolderAsync(pThis, _desiredName, options, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFolderWrapper.unwrapFrom(abi: operation)
@@ -1266,9 +1294,10 @@ extension __ABI_Windows_Storage {
 
         open func GetFileAsync(_ name: String) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.StorageFile?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _name = try! HString(name)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.GetFileAsync(pThis, _name.get(), &operationAbi))
+                try name.withHStringRef { _name in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.GetFileAsync(pThis, _name, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFileWrapper.unwrapFrom(abi: operation)
@@ -1276,9 +1305,10 @@ extension __ABI_Windows_Storage {
 
         open func GetFolderAsync(_ name: String) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.StorageFolder?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _name = try! HString(name)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.GetFolderAsync(pThis, _name.get(), &operationAbi))
+                try name.withHStringRef { _name in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.GetFolderAsync(pThis, _name, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFolderWrapper.unwrapFrom(abi: operation)
@@ -1286,9 +1316,10 @@ extension __ABI_Windows_Storage {
 
         open func GetItemAsync(_ name: String) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.AnyIStorageItem?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _name = try! HString(name)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.GetItemAsync(pThis, _name.get(), &operationAbi))
+                try name.withHStringRef { _name in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.GetItemAsync(pThis, _name, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CIStorageItemWrapper.unwrapFrom(abi: operation)
@@ -1482,12 +1513,15 @@ public protocol IStorageFolder2 : WinRTInterface {
 
 extension IStorageFolder2 {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage.IStorageFolder2Wrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageFolder2Wrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0xE827E8B9:
+                if iid == __ABI_Windows_Storage.IStorageFolder2Wrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageFolder2Wrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageFolder2 = any IStorageFolder2
@@ -1538,9 +1572,10 @@ extension __ABI_Windows_Storage {
 
         open func TryGetItemAsync(_ name: String) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.AnyIStorageItem?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _name = try! HString(name)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder2.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.TryGetItemAsync(pThis, _name.get(), &operationAbi))
+                try name.withHStringRef { _name in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolder2.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.TryGetItemAsync(pThis, _name, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CIStorageItemWrapper.unwrapFrom(abi: operation)
@@ -1626,12 +1661,15 @@ public protocol IStorageItem : WinRTInterface {
 
 extension IStorageItem {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage.IStorageItemWrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageItemWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x4207A996:
+                if iid == __ABI_Windows_Storage.IStorageItemWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageItemWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageItem = any IStorageItem
@@ -1727,9 +1765,10 @@ extension __ABI_Windows_Storage {
 
         open func RenameAsyncOverloadDefaultOptions(_ desiredName: String) throws -> WindowsFoundation.AnyIAsyncAction? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _desiredName = try! HString(desiredName)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageItem.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.RenameAsyncOverloadDefaultOptions(pThis, _desiredName.get(), &operationAbi))
+                try desiredName.withHStringRef { _desiredName in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageItem.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.RenameAsyncOverloadDefaultOptions(pThis, _desiredName, &operationAbi))
+                    }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: operation)
@@ -1737,9 +1776,10 @@ extension __ABI_Windows_Storage {
 
         open func RenameAsync(_ desiredName: String, _ option: UWP.NameCollisionOption) throws -> WindowsFoundation.AnyIAsyncAction? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _desiredName = try! HString(desiredName)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageItem.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.RenameAsync(pThis, _desiredName.get(), option, &operationAbi))
+                try desiredName.withHStringRef { _desiredName in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageItem.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.RenameAsync(pThis, _desiredName, option, &operationAbi))
+                    }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: operation)
@@ -1959,15 +1999,20 @@ public protocol IStorageItem2 : IStorageItem {
 
 extension IStorageItem2 {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage.IStorageItem2Wrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageItem2Wrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage.IStorageItemWrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageItemWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x4207A996:
+                if iid == __ABI_Windows_Storage.IStorageItemWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageItemWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x53F926D2:
+                if iid == __ABI_Windows_Storage.IStorageItem2Wrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageItem2Wrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageItem2 = any IStorageItem2
@@ -2175,12 +2220,15 @@ public protocol IStorageItemProperties : WinRTInterface {
 
 extension IStorageItemProperties {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage.IStorageItemPropertiesWrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageItemPropertiesWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x86664478:
+                if iid == __ABI_Windows_Storage.IStorageItemPropertiesWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageItemPropertiesWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageItemProperties = any IStorageItemProperties
@@ -2441,15 +2489,20 @@ public protocol IStorageItemProperties2 : IStorageItemProperties {
 
 extension IStorageItemProperties2 {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage.IStorageItemProperties2Wrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageItemProperties2Wrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage.IStorageItemPropertiesWrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageItemPropertiesWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x86664478:
+                if iid == __ABI_Windows_Storage.IStorageItemPropertiesWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageItemPropertiesWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x8E86A951:
+                if iid == __ABI_Windows_Storage.IStorageItemProperties2Wrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageItemProperties2Wrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageItemProperties2 = any IStorageItemProperties2
@@ -2659,15 +2712,20 @@ public protocol IStorageItemPropertiesWithProvider : IStorageItemProperties {
 
 extension IStorageItemPropertiesWithProvider {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage.IStorageItemPropertiesWithProviderWrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageItemPropertiesWithProviderWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Storage.IStorageItemPropertiesWrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStorageItemPropertiesWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x861BF39B:
+                if iid == __ABI_Windows_Storage.IStorageItemPropertiesWithProviderWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageItemPropertiesWithProviderWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x86664478:
+                if iid == __ABI_Windows_Storage.IStorageItemPropertiesWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStorageItemPropertiesWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStorageItemPropertiesWithProvider = any IStorageItemPropertiesWithProvider
@@ -2820,12 +2878,15 @@ public protocol IStreamedFileDataRequest : WinRTInterface {
 
 extension IStreamedFileDataRequest {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Storage.IStreamedFileDataRequestWrapper.IID:
-                let wrapper = __ABI_Windows_Storage.IStreamedFileDataRequestWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x1673FCCE:
+                if iid == __ABI_Windows_Storage.IStreamedFileDataRequestWrapper.IID {
+                    let wrapper = __ABI_Windows_Storage.IStreamedFileDataRequestWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStreamedFileDataRequest = any IStreamedFileDataRequest
@@ -3025,9 +3086,10 @@ extension __ABI_Windows_Storage {
 
         public func ReadTextAsync(_ absolutePath: String) throws -> WindowsFoundation.AnyIAsyncOperation<String>? {
             let (textOperation) = try ComPtrs.initialize { textOperationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.ReadTextAsync(pThis, _absolutePath.get(), &textOperationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.ReadTextAsync(pThis, _absolutePath, &textOperationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1_HSTRINGWrapper.unwrapFrom(abi: textOperation)
@@ -3035,9 +3097,10 @@ extension __ABI_Windows_Storage {
 
         public func ReadTextWithEncodingAsync(_ absolutePath: String, _ encoding: UWP.UnicodeEncoding) throws -> WindowsFoundation.AnyIAsyncOperation<String>? {
             let (textOperation) = try ComPtrs.initialize { textOperationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.ReadTextWithEncodingAsync(pThis, _absolutePath.get(), encoding, &textOperationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.ReadTextWithEncodingAsync(pThis, _absolutePath, encoding, &textOperationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1_HSTRINGWrapper.unwrapFrom(abi: textOperation)
@@ -3045,10 +3108,12 @@ extension __ABI_Windows_Storage {
 
         public func WriteTextAsync(_ absolutePath: String, _ contents: String) throws -> WindowsFoundation.AnyIAsyncAction? {
             let (textOperation) = try ComPtrs.initialize { textOperationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                let _contents = try! HString(contents)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.WriteTextAsync(pThis, _absolutePath.get(), _contents.get(), &textOperationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    try contents.withHStringRef { _contents in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.WriteTextAsync(pThis, _absolutePath, _contents, &textOperationAbi))
+                    }
+                }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: textOperation)
@@ -3056,10 +3121,12 @@ extension __ABI_Windows_Storage {
 
         public func WriteTextWithEncodingAsync(_ absolutePath: String, _ contents: String, _ encoding: UWP.UnicodeEncoding) throws -> WindowsFoundation.AnyIAsyncAction? {
             let (textOperation) = try ComPtrs.initialize { textOperationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                let _contents = try! HString(contents)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.WriteTextWithEncodingAsync(pThis, _absolutePath.get(), _contents.get(), encoding, &textOperationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    try contents.withHStringRef { _contents in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.WriteTextWithEncodingAsync(pThis, _absolutePath, _contents, encoding, &textOperationAbi))
+                    }
+                }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: textOperation)
@@ -3067,10 +3134,12 @@ extension __ABI_Windows_Storage {
 
         public func AppendTextAsync(_ absolutePath: String, _ contents: String) throws -> WindowsFoundation.AnyIAsyncAction? {
             let (textOperation) = try ComPtrs.initialize { textOperationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                let _contents = try! HString(contents)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.AppendTextAsync(pThis, _absolutePath.get(), _contents.get(), &textOperationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    try contents.withHStringRef { _contents in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.AppendTextAsync(pThis, _absolutePath, _contents, &textOperationAbi))
+                    }
+                }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: textOperation)
@@ -3078,10 +3147,12 @@ extension __ABI_Windows_Storage {
 
         public func AppendTextWithEncodingAsync(_ absolutePath: String, _ contents: String, _ encoding: UWP.UnicodeEncoding) throws -> WindowsFoundation.AnyIAsyncAction? {
             let (textOperation) = try ComPtrs.initialize { textOperationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                let _contents = try! HString(contents)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.AppendTextWithEncodingAsync(pThis, _absolutePath.get(), _contents.get(), encoding, &textOperationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    try contents.withHStringRef { _contents in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.AppendTextWithEncodingAsync(pThis, _absolutePath, _contents, encoding, &textOperationAbi))
+                    }
+                }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: textOperation)
@@ -3089,9 +3160,10 @@ extension __ABI_Windows_Storage {
 
         public func ReadLinesAsync(_ absolutePath: String) throws -> WindowsFoundation.AnyIAsyncOperation<WindowsFoundation.AnyIVector<String>?>? {
             let (linesOperation) = try ComPtrs.initialize { linesOperationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.ReadLinesAsync(pThis, _absolutePath.get(), &linesOperationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.ReadLinesAsync(pThis, _absolutePath, &linesOperationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_C__FIVector_1_HSTRINGWrapper.unwrapFrom(abi: linesOperation)
@@ -3099,9 +3171,10 @@ extension __ABI_Windows_Storage {
 
         public func ReadLinesWithEncodingAsync(_ absolutePath: String, _ encoding: UWP.UnicodeEncoding) throws -> WindowsFoundation.AnyIAsyncOperation<WindowsFoundation.AnyIVector<String>?>? {
             let (linesOperation) = try ComPtrs.initialize { linesOperationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.ReadLinesWithEncodingAsync(pThis, _absolutePath.get(), encoding, &linesOperationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.ReadLinesWithEncodingAsync(pThis, _absolutePath, encoding, &linesOperationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_C__FIVector_1_HSTRINGWrapper.unwrapFrom(abi: linesOperation)
@@ -3109,11 +3182,12 @@ extension __ABI_Windows_Storage {
 
         public func WriteLinesAsync(_ absolutePath: String, _ lines: WindowsFoundation.AnyIIterable<String>?) throws -> WindowsFoundation.AnyIAsyncAction? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                let linesWrapper = UWP.__x_ABI_C__FIIterable_1_HSTRINGWrapper(lines)
-                let _lines = try! linesWrapper?.toABI { $0 }
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.WriteLinesAsync(pThis, _absolutePath.get(), _lines, &operationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    let linesWrapper = UWP.__x_ABI_C__FIIterable_1_HSTRINGWrapper(lines)
+                    let _lines = try! linesWrapper?.toABI { $0 }
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.WriteLinesAsync(pThis, _absolutePath, _lines, &operationAbi))
+                    }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: operation)
@@ -3121,11 +3195,12 @@ extension __ABI_Windows_Storage {
 
         public func WriteLinesWithEncodingAsync(_ absolutePath: String, _ lines: WindowsFoundation.AnyIIterable<String>?, _ encoding: UWP.UnicodeEncoding) throws -> WindowsFoundation.AnyIAsyncAction? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                let linesWrapper = UWP.__x_ABI_C__FIIterable_1_HSTRINGWrapper(lines)
-                let _lines = try! linesWrapper?.toABI { $0 }
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.WriteLinesWithEncodingAsync(pThis, _absolutePath.get(), _lines, encoding, &operationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    let linesWrapper = UWP.__x_ABI_C__FIIterable_1_HSTRINGWrapper(lines)
+                    let _lines = try! linesWrapper?.toABI { $0 }
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.WriteLinesWithEncodingAsync(pThis, _absolutePath, _lines, encoding, &operationAbi))
+                    }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: operation)
@@ -3133,11 +3208,12 @@ extension __ABI_Windows_Storage {
 
         public func AppendLinesAsync(_ absolutePath: String, _ lines: WindowsFoundation.AnyIIterable<String>?) throws -> WindowsFoundation.AnyIAsyncAction? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                let linesWrapper = UWP.__x_ABI_C__FIIterable_1_HSTRINGWrapper(lines)
-                let _lines = try! linesWrapper?.toABI { $0 }
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.AppendLinesAsync(pThis, _absolutePath.get(), _lines, &operationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    let linesWrapper = UWP.__x_ABI_C__FIIterable_1_HSTRINGWrapper(lines)
+                    let _lines = try! linesWrapper?.toABI { $0 }
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.AppendLinesAsync(pThis, _absolutePath, _lines, &operationAbi))
+                    }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: operation)
@@ -3145,11 +3221,12 @@ extension __ABI_Windows_Storage {
 
         public func AppendLinesWithEncodingAsync(_ absolutePath: String, _ lines: WindowsFoundation.AnyIIterable<String>?, _ encoding: UWP.UnicodeEncoding) throws -> WindowsFoundation.AnyIAsyncAction? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                let linesWrapper = UWP.__x_ABI_C__FIIterable_1_HSTRINGWrapper(lines)
-                let _lines = try! linesWrapper?.toABI { $0 }
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.AppendLinesWithEncodingAsync(pThis, _absolutePath.get(), _lines, encoding, &operationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    let linesWrapper = UWP.__x_ABI_C__FIIterable_1_HSTRINGWrapper(lines)
+                    let _lines = try! linesWrapper?.toABI { $0 }
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.AppendLinesWithEncodingAsync(pThis, _absolutePath, _lines, encoding, &operationAbi))
+                    }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: operation)
@@ -3157,9 +3234,10 @@ extension __ABI_Windows_Storage {
 
         public func ReadBufferAsync(_ absolutePath: String) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.AnyIBuffer?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.ReadBufferAsync(pThis, _absolutePath.get(), &operationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.ReadBufferAsync(pThis, _absolutePath, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStreams__CIBufferWrapper.unwrapFrom(abi: operation)
@@ -3167,11 +3245,12 @@ extension __ABI_Windows_Storage {
 
         public func WriteBufferAsync(_ absolutePath: String, _ buffer: UWP.AnyIBuffer?) throws -> WindowsFoundation.AnyIAsyncAction? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                let bufferWrapper = __ABI_Windows_Storage_Streams.IBufferWrapper(buffer)
-                let _buffer = try! bufferWrapper?.toABI { $0 }
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.WriteBufferAsync(pThis, _absolutePath.get(), _buffer, &operationAbi))
+                try absolutePath.withHStringRef { _absolutePath in
+                    let bufferWrapper = __ABI_Windows_Storage_Streams.IBufferWrapper(buffer)
+                    let _buffer = try! bufferWrapper?.toABI { $0 }
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.WriteBufferAsync(pThis, _absolutePath, _buffer, &operationAbi))
+                    }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: operation)
@@ -3179,11 +3258,12 @@ extension __ABI_Windows_Storage {
 
         public func WriteBytesAsync(_ absolutePath: String, _ buffer: [UInt8]) throws -> WindowsFoundation.AnyIAsyncAction? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _absolutePath = try! HString(absolutePath)
-                try buffer.toABI { _buffer in
-                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
-                        try CHECKED(pThis.pointee.lpVtbl.pointee.WriteBytesAsync(pThis, _absolutePath.get(), _buffer.count, _buffer.start, &operationAbi))
-                    }
+                try absolutePath.withHStringRef { _absolutePath in
+                    try buffer.toABI { _buffer in
+                        _ = try perform(as: __x_ABI_CWindows_CStorage_CIPathIOStatics.self) { pThis in
+                            try CHECKED(pThis.pointee.lpVtbl.pointee.WriteBytesAsync(pThis, _absolutePath, _buffer.count, _buffer.start, &operationAbi))
+                        }
+                }
                 }
             }
             return __ABI_Windows_Foundation.IAsyncActionWrapper.unwrapFrom(abi: operation)
@@ -3507,9 +3587,10 @@ extension __ABI_Windows_Storage {
 
         public func GetFileFromPathAsync(_ path: String) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.StorageFile?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _path = try! HString(path)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFileStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.GetFileFromPathAsync(pThis, _path.get(), &operationAbi))
+                try path.withHStringRef { _path in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFileStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.GetFileFromPathAsync(pThis, _path, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFileWrapper.unwrapFrom(abi: operation)
@@ -3526,13 +3607,14 @@ extension __ABI_Windows_Storage {
 
         public func CreateStreamedFileAsync(_ displayNameWithExtension: String, _ dataRequested: UWP.StreamedFileDataRequestedHandler?, _ thumbnail: UWP.AnyIRandomAccessStreamReference?) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.StorageFile?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _displayNameWithExtension = try! HString(displayNameWithExtension)
-                let dataRequestedWrapper = __ABI_Windows_Storage.StreamedFileDataRequestedHandlerWrapper(dataRequested)
-                let _dataRequested = try! dataRequestedWrapper?.toABI { $0 }
-                let thumbnailWrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamReferenceWrapper(thumbnail)
-                let _thumbnail = try! thumbnailWrapper?.toABI { $0 }
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFileStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateStreamedFileAsync(pThis, _displayNameWithExtension.get(), _dataRequested, _thumbnail, &operationAbi))
+                try displayNameWithExtension.withHStringRef { _displayNameWithExtension in
+                    let dataRequestedWrapper = __ABI_Windows_Storage.StreamedFileDataRequestedHandlerWrapper(dataRequested)
+                    let _dataRequested = try! dataRequestedWrapper?.toABI { $0 }
+                    let thumbnailWrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamReferenceWrapper(thumbnail)
+                    let _thumbnail = try! thumbnailWrapper?.toABI { $0 }
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFileStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateStreamedFileAsync(pThis, _displayNameWithExtension, _dataRequested, _thumbnail, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFileWrapper.unwrapFrom(abi: operation)
@@ -3555,11 +3637,12 @@ extension __ABI_Windows_Storage {
 
         public func CreateStreamedFileFromUriAsync(_ displayNameWithExtension: String, _ uri: WindowsFoundation.Uri?, _ thumbnail: UWP.AnyIRandomAccessStreamReference?) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.StorageFile?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _displayNameWithExtension = try! HString(displayNameWithExtension)
-                let thumbnailWrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamReferenceWrapper(thumbnail)
-                let _thumbnail = try! thumbnailWrapper?.toABI { $0 }
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFileStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateStreamedFileFromUriAsync(pThis, _displayNameWithExtension.get(), RawPointer(uri), _thumbnail, &operationAbi))
+                try displayNameWithExtension.withHStringRef { _displayNameWithExtension in
+                    let thumbnailWrapper = __ABI_Windows_Storage_Streams.IRandomAccessStreamReferenceWrapper(thumbnail)
+                    let _thumbnail = try! thumbnailWrapper?.toABI { $0 }
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFileStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateStreamedFileFromUriAsync(pThis, _displayNameWithExtension, RawPointer(uri), _thumbnail, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFileWrapper.unwrapFrom(abi: operation)
@@ -3589,9 +3672,10 @@ extension __ABI_Windows_Storage {
 
         public func GetFileFromPathForUserAsync(_ user: UWP.User?, _ path: String) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.StorageFile?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _path = try! HString(path)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFileStatics2.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.GetFileFromPathForUserAsync(pThis, RawPointer(user), _path.get(), &operationAbi))
+                try path.withHStringRef { _path in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFileStatics2.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.GetFileFromPathForUserAsync(pThis, RawPointer(user), _path, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFileWrapper.unwrapFrom(abi: operation)
@@ -3966,9 +4050,10 @@ extension __ABI_Windows_Storage {
 
         public func GetFolderFromPathAsync(_ path: String) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.StorageFolder?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _path = try! HString(path)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolderStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.GetFolderFromPathAsync(pThis, _path.get(), &operationAbi))
+                try path.withHStringRef { _path in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolderStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.GetFolderFromPathAsync(pThis, _path, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFolderWrapper.unwrapFrom(abi: operation)
@@ -3985,9 +4070,10 @@ extension __ABI_Windows_Storage {
 
         public func GetFolderFromPathForUserAsync(_ user: UWP.User?, _ path: String) throws -> WindowsFoundation.AnyIAsyncOperation<UWP.StorageFolder?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _path = try! HString(path)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolderStatics2.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.GetFolderFromPathForUserAsync(pThis, RawPointer(user), _path.get(), &operationAbi))
+                try path.withHStringRef { _path in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageFolderStatics2.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.GetFolderFromPathForUserAsync(pThis, RawPointer(user), _path, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1___x_ABI_CWindows__CStorage__CStorageFolderWrapper.unwrapFrom(abi: operation)
@@ -4543,9 +4629,10 @@ extension __ABI_Windows_Storage {
 
         public func IsPropertySupportedForPartialFileAsync(_ propertyCanonicalName: String) throws -> WindowsFoundation.AnyIAsyncOperation<Bool>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _propertyCanonicalName = try! HString(propertyCanonicalName)
-                _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageProvider2.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.IsPropertySupportedForPartialFileAsync(pThis, _propertyCanonicalName.get(), &operationAbi))
+                try propertyCanonicalName.withHStringRef { _propertyCanonicalName in
+                    _ = try perform(as: __x_ABI_CWindows_CStorage_CIStorageProvider2.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.IsPropertySupportedForPartialFileAsync(pThis, _propertyCanonicalName, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1_booleanWrapper.unwrapFrom(abi: operation)
@@ -302,9 +302,10 @@ extension __ABI_Windows_System {
 
         public func GetPropertyAsync(_ value: String) throws -> WindowsFoundation.AnyIAsyncOperation<Any?>? {
             let (operation) = try ComPtrs.initialize { operationAbi in
-                let _value = try! HString(value)
-                _ = try perform(as: __x_ABI_CWindows_CSystem_CIUser.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.GetPropertyAsync(pThis, _value.get(), &operationAbi))
+                try value.withHStringRef { _value in
+                    _ = try perform(as: __x_ABI_CWindows_CSystem_CIUser.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.GetPropertyAsync(pThis, _value, &operationAbi))
+                    }
                 }
             }
             return UWP.__x_ABI_C__FIAsyncOperation_1_IInspectableWrapper.unwrapFrom(abi: operation)
@@ -395,9 +396,10 @@ extension __ABI_Windows_System {
 
         public func GetFromId(_ nonRoamableId: String) throws -> UWP.User? {
             let (result) = try ComPtrs.initialize { resultAbi in
-                let _nonRoamableId = try! HString(nonRoamableId)
-                _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.GetFromId(pThis, _nonRoamableId.get(), &resultAbi))
+                try nonRoamableId.withHStringRef { _nonRoamableId in
+                    _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.GetFromId(pThis, _nonRoamableId, &resultAbi))
+                    }
                 }
             }
             return __IMPL_Windows_System.UserBridge.from(abi: result)
@@ -740,12 +742,13 @@ public final class UserWatcher : WinRTClass {
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.system.userwatcher.added)
     public lazy var added : Event<TypedEventHandler<UserWatcher?, UserChangedEventArgs?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher___x_ABI_CWindows__CSystem__CUserChangedEventArgsBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_Added($0)
+          return try this.add_Added($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_Added($0)
+         try self?._default.remove_Added($0)
        }
       )
     }()
@@ -753,12 +756,13 @@ public final class UserWatcher : WinRTClass {
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.system.userwatcher.authenticationstatuschanged)
     public lazy var authenticationStatusChanged : Event<TypedEventHandler<UserWatcher?, UserChangedEventArgs?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher___x_ABI_CWindows__CSystem__CUserChangedEventArgsBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_AuthenticationStatusChanged($0)
+          return try this.add_AuthenticationStatusChanged($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_AuthenticationStatusChanged($0)
+         try self?._default.remove_AuthenticationStatusChanged($0)
        }
       )
     }()
@@ -766,12 +770,13 @@ public final class UserWatcher : WinRTClass {
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.system.userwatcher.authenticationstatuschanging)
     public lazy var authenticationStatusChanging : Event<TypedEventHandler<UserWatcher?, UserAuthenticationStatusChangingEventArgs?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher___x_ABI_CWindows__CSystem__CUserAuthenticationStatusChangingEventArgsBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_AuthenticationStatusChanging($0)
+          return try this.add_AuthenticationStatusChanging($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_AuthenticationStatusChanging($0)
+         try self?._default.remove_AuthenticationStatusChanging($0)
        }
       )
     }()
@@ -779,12 +784,13 @@ public final class UserWatcher : WinRTClass {
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.system.userwatcher.enumerationcompleted)
     public lazy var enumerationCompleted : Event<TypedEventHandler<UserWatcher?, Any?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher_IInspectableBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_EnumerationCompleted($0)
+          return try this.add_EnumerationCompleted($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_EnumerationCompleted($0)
+         try self?._default.remove_EnumerationCompleted($0)
        }
       )
     }()
@@ -792,12 +798,13 @@ public final class UserWatcher : WinRTClass {
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.system.userwatcher.removed)
     public lazy var removed : Event<TypedEventHandler<UserWatcher?, UserChangedEventArgs?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher___x_ABI_CWindows__CSystem__CUserChangedEventArgsBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_Removed($0)
+          return try this.add_Removed($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_Removed($0)
+         try self?._default.remove_Removed($0)
        }
       )
     }()
@@ -805,12 +812,13 @@ public final class UserWatcher : WinRTClass {
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.system.userwatcher.stopped)
     public lazy var stopped : Event<TypedEventHandler<UserWatcher?, Any?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher_IInspectableBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_Stopped($0)
+          return try this.add_Stopped($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_Stopped($0)
+         try self?._default.remove_Stopped($0)
        }
       )
     }()
@@ -818,12 +826,13 @@ public final class UserWatcher : WinRTClass {
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.system.userwatcher.updated)
     public lazy var updated : Event<TypedEventHandler<UserWatcher?, UserChangedEventArgs?>> = {
       .init(
+        bridge: UWP.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher___x_ABI_CWindows__CSystem__CUserChangedEventArgsBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_Updated($0)
+          return try this.add_Updated($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_Updated($0)
+         try self?._default.remove_Updated($0)
        }
       )
     }()
@@ -893,6 +902,15 @@ extension __ABI_Windows_System {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_Added(_ handler: UnsafeMutablePointer<__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher___x_ABI_CWindows__CSystem__CUserChangedEventArgs>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_Added(pThis, handler, &token))
+            }
+            return token
+        }
+
         public func remove_Added(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_Added(pThis, token))
@@ -909,6 +927,15 @@ extension __ABI_Windows_System {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_Removed(_ handler: UnsafeMutablePointer<__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher___x_ABI_CWindows__CSystem__CUserChangedEventArgs>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_Removed(pThis, handler, &token))
+            }
+            return token
+        }
+
         public func remove_Removed(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_Removed(pThis, token))
@@ -925,6 +952,15 @@ extension __ABI_Windows_System {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_Updated(_ handler: UnsafeMutablePointer<__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher___x_ABI_CWindows__CSystem__CUserChangedEventArgs>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_Updated(pThis, handler, &token))
+            }
+            return token
+        }
+
         public func remove_Updated(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_Updated(pThis, token))
@@ -941,6 +977,15 @@ extension __ABI_Windows_System {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_AuthenticationStatusChanged(_ handler: UnsafeMutablePointer<__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher___x_ABI_CWindows__CSystem__CUserChangedEventArgs>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_AuthenticationStatusChanged(pThis, handler, &token))
+            }
+            return token
+        }
+
         public func remove_AuthenticationStatusChanged(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_AuthenticationStatusChanged(pThis, token))
@@ -957,6 +1002,15 @@ extension __ABI_Windows_System {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_AuthenticationStatusChanging(_ handler: UnsafeMutablePointer<__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher___x_ABI_CWindows__CSystem__CUserAuthenticationStatusChangingEventArgs>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_AuthenticationStatusChanging(pThis, handler, &token))
+            }
+            return token
+        }
+
         public func remove_AuthenticationStatusChanging(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_AuthenticationStatusChanging(pThis, token))
@@ -973,6 +1027,15 @@ extension __ABI_Windows_System {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_EnumerationCompleted(_ handler: UnsafeMutablePointer<__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher_IInspectable>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_EnumerationCompleted(pThis, handler, &token))
+            }
+            return token
+        }
+
         public func remove_EnumerationCompleted(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_EnumerationCompleted(pThis, token))
@@ -989,6 +1052,15 @@ extension __ABI_Windows_System {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_Stopped(_ handler: UnsafeMutablePointer<__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CSystem__CUserWatcher_IInspectable>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_Stopped(pThis, handler, &token))
+            }
+            return token
+        }
+
         public func remove_Stopped(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_CWindows_CSystem_CIUserWatcher.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_Stopped(pThis, token))
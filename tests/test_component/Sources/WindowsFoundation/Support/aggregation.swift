@@ -119,6 +119,21 @@ public class UnsealedWinRTClassWrapper<Composable: ComposableImpl> : WinRTAbiBri
         tryUnwrapFromBase(raw: pUnk)?.instance
     }
 
+    // The vtables of overrides interfaces use these rather than addRef and release, since references held
+    // through the ABI have to keep the aggregating Swift object alive as well as the wrapper.
+    public static func addRefAggregated(_ pUnk: UnsafeMutablePointer<Composable.CABI>?) -> ULONG {
+        guard let unmanaged = fromRaw(pUnk) else { return 1 }
+        unmanaged._withUnsafeGuaranteedRef { $0.swiftObj.addRef() }
+        return addRef(pUnk)
+    }
+
+    public static func releaseAggregated(_ pUnk: UnsafeMutablePointer<Composable.CABI>?) -> ULONG {
+        guard let unmanaged = fromRaw(pUnk) else { return 1 }
+        // Releasing the object first, since the last release of the wrapper frees it
+        unmanaged._withUnsafeGuaranteedRef { $0.swiftObj.release() }
+        return release(pUnk)
+    }
+
     public func toIInspectableABI<ResultType>(_ body: (UnsafeMutablePointer<C_IInspectable>) throws -> ResultType)
         rethrows -> ResultType {
         let abi = try! toABI { $0 }
@@ -30,6 +30,44 @@ extension Array where Element: ToAbi {
     }
 }
 
+@_spi(WinRTInternal)
+extension Array where Element: WinRTBlittableStruct {
+    public func toABI(_ withAbi: (WinRTArrayAbi<Element.ABI>) throws -> Void) throws {
+        guard Element.hasAbiLayout else {
+            // toABI on a blittable struct only copies its fields, so it never actually throws
+            let abiArray: [Element.ABI] = map { try! $0.toABI() }
+            try abiArray.withUnsafeBufferPointer {
+                try withAbi((count: UInt32(count), start: .init(mutating: $0.baseAddress)))
+            }
+            return
+        }
+        try withUnsafeBytes { (bytes: UnsafeRawBufferPointer) in
+            let bytesPtr = bytes.baseAddress?.assumingMemoryBound(to: Element.ABI.self)
+            try withAbi((count: UInt32(count), start: .init(mutating: bytesPtr)))
+        }
+    }
+
+    public func fill(abi: UnsafeMutablePointer<Element.ABI>?) {
+        guard let abi else { return }
+        guard Element.hasAbiLayout else {
+            for (index, element) in enumerated() {
+                abi[index] = try! element.toABI()
+            }
+            return
+        }
+        withUnsafeBytes { (bytes: UnsafeRawBufferPointer) in
+            guard let baseAddress = bytes.baseAddress else { return }
+            UnsafeMutableRawPointer(abi).copyMemory(from: baseAddress, byteCount: bytes.count)
+        }
+    }
+
+    public func fill(abi: UnsafeMutablePointer<UnsafeMutablePointer<Element.ABI>?>?) {
+        guard let abi else { return }
+        abi.pointee = CoTaskMemAlloc(UInt64(MemoryLayout<Element.ABI>.stride * count)).assumingMemoryBound(to: Element.ABI.self)
+        fill(abi: abi.pointee)
+    }
+}
+
 @_spi(WinRTInternal)
 extension Array where  Element: Numeric {
     public func toABI(_ withAbi: (WinRTArrayAbi<Element>) throws -> Void) throws {
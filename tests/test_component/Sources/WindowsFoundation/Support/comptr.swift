@@ -10,7 +10,7 @@ import CWinRT
 
 // where it's required at the ABI boundary.
 public struct ComPtr<CInterface>: ~Copyable {
-    fileprivate var pUnk: UnsafeMutablePointer<CInterface>?
+    @usableFromInline var pUnk: UnsafeMutablePointer<CInterface>?
 
     public init(_ ptr: UnsafeMutablePointer<CInterface>) {
         self.pUnk = ptr
@@ -38,6 +38,7 @@ public struct ComPtr<CInterface>: ~Copyable {
         return UnsafeMutableRawPointer(result)
     }
 
+    @inlinable
     public borrowing func get() -> UnsafeMutablePointer<CInterface> {
       guard let pUnk else { preconditionFailure("get() called on nil pointer") }
       return pUnk
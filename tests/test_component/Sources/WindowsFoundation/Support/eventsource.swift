@@ -1,52 +1,129 @@
 import WinSDK
 import CWinRT
+import Synchronization
 
 /// EventSource is the class which implements handling event subscriptions, removals,
 /// and invoking events for authoring events in Swift
+///
+/// The subscriptions are kept in an immutable snapshot which adding or removing a handler replaces
+/// as a whole, so raising an event only loads the current snapshot without taking a lock or copying.
+/// Replaced snapshots are released as soon as no raise is in progress, by the change which replaced them
+/// or by the last raise to finish.
 @propertyWrapper public class EventSource<Handler> {
     private struct Subscription {
         var handler: Handler
         var token: CWinRT.EventRegistrationToken
     }
 
+    private final class Snapshot {
+        let subscriptions: [Subscription]
+        // the position of each subscription by token, so that removing one doesn't have to search for it
+        let positions: [Int64: Int]
+
+        init(_ subscriptions: [Subscription]) {
+            self.subscriptions = subscriptions
+            var positions = [Int64: Int](minimumCapacity: subscriptions.count)
+            for (position, subscription) in subscriptions.enumerated() {
+                positions[subscription.token.value] = position
+            }
+            self.positions = positions
+        }
+    }
+
     private var event: Event<Handler>!
-    private var subscriptions = [Subscription]()
+    private let snapshot: Atomic<Unmanaged<Snapshot>>
+    // the number of raises in progress, replaced snapshots can't be released while it isn't zero
+    private let readers = Atomic<Int>(0)
+    // whether there are replaced snapshots left to release, so that raises only take the lock when there are
+    private let hasRetired = Atomic<Bool>(false)
+    // everything below is only used under the lock
+    private var retired = [Unmanaged<Snapshot>]()
     private var nextToken: Int64 = 0
     private var lock = SRWLock()
 
     public init() {
+        snapshot = .init(.passRetained(Snapshot([])))
         event = .init(
           add: { [weak self] in self?.append($0) ?? .init() },
           remove: { [weak self] in self?.remove(token: $0) }
         )
     }
 
+    deinit {
+        snapshot.load(ordering: .relaxed).release()
+        for replaced in retired {
+            replaced.release()
+        }
+    }
+
     public var wrappedValue: Event<Handler> { event }
 
     public func invokeAll(_ body: (Handler) throws -> Void) rethrows {
-        let subscriptionsCopy = lock.withLock(.shared) { subscriptions }
-        for subscription in subscriptionsCopy {
+        // announce the raise before loading the snapshot, any change which doesn't see it has already
+        // published a newer snapshot than the one loaded here
+        readers.wrappingAdd(1, ordering: .sequentiallyConsistent)
+        defer {
+            if readers.wrappingSubtract(1, ordering: .sequentiallyConsistent).newValue == 0 {
+                reclaimRetired()
+            }
+        }
+        let current = snapshot.load(ordering: .sequentiallyConsistent).takeUnretainedValue()
+        for subscription in current.subscriptions {
             try body(subscription.handler)
         }
     }
 
     private func append(_ handler: Handler) -> CWinRT.EventRegistrationToken {
+        defer { reclaimRetired() }
         return lock.withLock(.exclusive) {
             let token = CWinRT.EventRegistrationToken(value: nextToken)
             defer { nextToken += 1 }
-            subscriptions.append(.init(handler: handler, token: token))
+            let current = snapshot.load(ordering: .sequentiallyConsistent).takeUnretainedValue()
+            publish(current.subscriptions + [.init(handler: handler, token: token)])
             return token
         }
     }
 
     private func remove(token: CWinRT.EventRegistrationToken) {
+        defer { reclaimRetired() }
         lock.withLock(.exclusive) {
-            // The semantics when the same event handler is added multiple times
-            // is to append to the end and to remove the last occurrence first.
-            if let index = subscriptions.lastIndex(where: { $0.token == token }) {
-                subscriptions.remove(at: index)
-            }
+            // Tokens are unique, so when the same event handler is added multiple times
+            // each registration is removed on its own.
+            let current = snapshot.load(ordering: .sequentiallyConsistent).takeUnretainedValue()
+            guard let position = current.positions[token.value] else { return }
+            var subscriptions = current.subscriptions
+            subscriptions.remove(at: position)
+            publish(subscriptions)
+        }
+    }
+
+    // Must be called with the lock held exclusively
+    private func publish(_ subscriptions: [Subscription]) {
+        let replaced = snapshot.exchange(.passRetained(Snapshot(subscriptions)), ordering: .sequentiallyConsistent)
+        retired.append(replaced)
+        hasRetired.store(true, ordering: .sequentiallyConsistent)
+        releaseRetired()
+    }
+
+    // Called after letting go of the lock, by changes and by the last raise to finish. Whoever can't take the lock
+    // leaves the snapshots to the thread holding it, which checks again here once it has let go, so they aren't
+    // stranded by a raise which finished after the holder's own check.
+    private func reclaimRetired() {
+        while hasRetired.load(ordering: .sequentiallyConsistent) && readers.load(ordering: .sequentiallyConsistent) == 0 {
+            guard lock.withLockIfAvailable({ releaseRetired() }) != nil else { return }
+        }
+    }
+
+    // Must be called with the lock held exclusively
+    private func releaseRetired() {
+        // a raise which is still in progress may be using any of the retired snapshots, while one
+        // which starts after this check can only load the snapshot which was just published
+        guard readers.load(ordering: .sequentiallyConsistent) == 0 else { return }
+        for replaced in retired {
+            replaced.release()
         }
+        retired.removeAll(keepingCapacity: true)
+        hasRetired.store(false, ordering: .sequentiallyConsistent)
     }
 }
 
@@ -0,0 +1,182 @@
+import Foundation
+
+// The generated get() and progressUpdates() members of the async interfaces hand their handler setters to
+// these, since the handlers are typed per interface but the waiting is the same for all of them.
+extension IAsyncInfo {
+    /// Suspends until the operation completes. Cancelling the awaiting task cancels the operation, which then
+    /// throws `CancellationError`.
+    func waitForCompletion(setCompleted: (@escaping () -> Void) -> Void) async throws {
+        let handlers = AsyncInfoHandlers.of(self, setCompleted: setCompleted)
+        await withTaskCancellationHandler {
+            await withCheckedContinuation { continuation in
+                _ = handlers.addCompleted { continuation.resume() }
+            }
+        } onCancel: {
+            try? self.cancel()
+        }
+
+        if status == .canceled {
+            throw CancellationError()
+        }
+    }
+
+    /// Yields each progress report until the operation completes. Cancelling the iterating task cancels the
+    /// operation, while breaking out of the iteration leaves it running.
+    func makeProgressUpdates<Progress>(
+        setProgress: (@escaping (Progress) -> Void) -> Void,
+        setCompleted: (@escaping () -> Void) -> Void
+    ) -> AsyncProgressUpdates<Progress> {
+        let stream = AsyncStream<Progress> { continuation in
+            guard status == .started else {
+                continuation.finish()
+                return
+            }
+
+            let handlers = AsyncInfoHandlers.of(self, setCompleted: setCompleted)
+            let progressToken = handlers.addProgress({ continuation.yield($0 as! Progress) }) { report in
+                setProgress { report($0) }
+            }
+            let completedToken = handlers.addCompleted { continuation.finish() }
+            continuation.onTermination = { _ in
+                handlers.removeProgress(progressToken)
+                if let completedToken {
+                    handlers.removeCompleted(completedToken)
+                }
+            }
+        }
+        return AsyncProgressUpdates(stream) { try? self.cancel() }
+    }
+}
+
+/// The progress reports of a WinRT async operation, as returned by `progressUpdates()`.
+public struct AsyncProgressUpdates<Progress>: AsyncSequence {
+    public typealias Element = Progress
+
+    fileprivate let stream: AsyncStream<Progress>
+    fileprivate let cancel: () -> Void
+
+    fileprivate init(_ stream: AsyncStream<Progress>, cancel: @escaping () -> Void) {
+        self.stream = stream
+        self.cancel = cancel
+    }
+
+    public struct AsyncIterator: AsyncIteratorProtocol {
+        fileprivate var base: AsyncStream<Progress>.Iterator
+        fileprivate let cancel: () -> Void
+
+        // AsyncStream can't tell a cancelled task from a loop which stopped iterating, as both just terminate
+        // the stream, so the operation is only cancelled from here
+        public mutating func next() async -> Progress? {
+            var base = self.base
+            let cancel = self.cancel
+            return await withTaskCancellationHandler {
+                await base.next()
+            } onCancel: {
+                cancel()
+            }
+        }
+    }
+
+    public func makeAsyncIterator() -> AsyncIterator {
+        AsyncIterator(base: stream.makeAsyncIterator(), cancel: cancel)
+    }
+}
+
+// The Completed and Progress handlers of an operation can each only be set once, so the first get() or
+// progressUpdates() on an operation sets handlers which everything waiting on it afterwards shares. These are
+// found by the identity of the operation, since each projection of it is a different Swift object.
+fileprivate final class AsyncInfoHandlers {
+    private var lock = SRWLock()
+    private var isCompleted = false
+    private var isProgressSet = false
+    private var nextToken = 0
+    private var completedHandlers: [Int: () -> Void] = [:]
+    private var progressHandlers: [Int: (Any) -> Void] = [:]
+
+    // Held weakly, the handlers set on the operation keep these alive for as long as it is
+    private struct Entry {
+        weak var handlers: AsyncInfoHandlers?
+    }
+    private static var entries: [UnsafeMutableRawPointer: Entry] = [:]
+    private static var entriesLock = SRWLock()
+
+    static func of(_ asyncInfo: IAsyncInfo, setCompleted: (@escaping () -> Void) -> Void) -> AsyncInfoHandlers {
+        let key = identity(of: asyncInfo)
+        var created: AsyncInfoHandlers?
+        let handlers: AsyncInfoHandlers = entriesLock.withLock(.exclusive) {
+            if let existing = entries[key]?.handlers { return existing }
+            entries = entries.filter { $0.value.handlers != nil }
+            let handlers = AsyncInfoHandlers()
+            entries[key] = Entry(handlers: handlers)
+            created = handlers
+            return handlers
+        }
+
+        // Set outside of the lock, as an operation which has already completed calls the handler straight away
+        if let created {
+            setCompleted { created.complete() }
+        }
+        return handlers
+    }
+
+    private static func identity(of asyncInfo: IAsyncInfo) -> UnsafeMutableRawPointer {
+        if let object = winrtObject(asyncInfo), let identity: IUnknown = try? object.QueryInterface() {
+            return UnsafeMutableRawPointer(identity.pUnk.borrow)
+        }
+        return Unmanaged.passUnretained(asyncInfo as AnyObject).toOpaque()
+    }
+
+    /// Calls the handler once the operation completes, straight away if it already has. Returns nil in that case.
+    func addCompleted(_ handler: @escaping () -> Void) -> Int? {
+        let token: Int? = lock.withLock(.exclusive) {
+            guard !isCompleted else { return nil }
+            nextToken += 1
+            completedHandlers[nextToken] = handler
+            return nextToken
+        }
+        if token == nil {
+            handler()
+        }
+        return token
+    }
+
+    func removeCompleted(_ token: Int) {
+        lock.withLock(.exclusive) { _ = completedHandlers.removeValue(forKey: token) }
+    }
+
+    func addProgress(_ handler: @escaping (Any) -> Void, setProgress: (@escaping (Any) -> Void) -> Void) -> Int {
+        let (token, setsProgress): (Int, Bool) = lock.withLock(.exclusive) {
+            nextToken += 1
+            progressHandlers[nextToken] = handler
+            defer { isProgressSet = true }
+            return (nextToken, !isProgressSet)
+        }
+        if setsProgress {
+            setProgress { [self] in report($0) }
+        }
+        return token
+    }
+
+    func removeProgress(_ token: Int) {
+        lock.withLock(.exclusive) { _ = progressHandlers.removeValue(forKey: token) }
+    }
+
+    private func report(_ progress: Any) {
+        let handlers = lock.withLock(.shared) { progressHandlers.values }
+        for handler in handlers {
+            handler(progress)
+        }
+    }
+
+    private func complete() {
+        let handlers: Dictionary<Int, () -> Void>.Values = lock.withLock(.exclusive) {
+            isCompleted = true
+            progressHandlers.removeAll()
+            defer { completedHandlers.removeAll() }
+            return completedHandlers.values
+        }
+        for handler in handlers {
+            handler()
+        }
+    }
+}
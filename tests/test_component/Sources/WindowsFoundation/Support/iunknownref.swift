@@ -3,7 +3,7 @@
 
 @_fixed_layout
 public final class IUnknownRef {
-  private var pUnk: ComPtr<C_IUnknown>
+  @usableFromInline var pUnk: ComPtr<C_IUnknown>
 
   init<C_Interface>(_ pUnk: consuming ComPtr<C_Interface>) {
     let raw = pUnk.detach()
@@ -14,6 +14,8 @@ public final class IUnknownRef {
     return self.pUnk.detach()
   }
 
+  // Inlinable so that the @inlinable ABI thunks (see -inlinable-abi) reach the vtable without a call
+  @inlinable
   public var borrow: UnsafeMutablePointer<C_IUnknown> {
     return self.pUnk.get()
   }
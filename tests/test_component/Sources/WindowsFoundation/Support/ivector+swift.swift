@@ -40,4 +40,50 @@ public extension IVectorView {
         guard result else { return nil }
         return Int(index)
     }
-}
\ No newline at end of file
+}
+
+/// Iterates a vector by copying its elements out with GetMany, `batchSize` at a time, rather than with a GetAt
+/// call per element. The generated vector conformances return this from makeIterator(), passing the element
+/// type's default value as the placeholder which GetMany overwrites.
+public struct VectorIterator<Element>: IteratorProtocol {
+    private let getMany: (UInt32, inout [Element]) -> UInt32
+    private let size: UInt32
+    private let placeholder: Element
+    private let batchSize: Int
+    private var batch: [Element] = []
+    private var position: Int = 0
+    private var nextIndex: UInt32 = 0
+
+    public init<Vector: IVectorView>(_ vector: Vector, placeholder: Element, batchSize: Int = 64) where Vector.Element == Element {
+        self.init(size: vector.size, placeholder: placeholder, batchSize: batchSize) { vector.getMany($0, &$1) }
+    }
+
+    public init<Vector: IVector>(_ vector: Vector, placeholder: Element, batchSize: Int = 64) where Vector.Element == Element {
+        self.init(size: vector.size, placeholder: placeholder, batchSize: batchSize) { vector.getMany($0, &$1) }
+    }
+
+    private init(size: UInt32, placeholder: Element, batchSize: Int, getMany: @escaping (UInt32, inout [Element]) -> UInt32) {
+        precondition(batchSize > 0, "batchSize must be positive")
+        self.getMany = getMany
+        self.size = size
+        self.placeholder = placeholder
+        self.batchSize = batchSize
+    }
+
+    public mutating func next() -> Element? {
+        if position == batch.count {
+            guard nextIndex < size else { return nil }
+
+            // only ask for what is left so that the last batch doesn't marshal placeholders for nothing
+            batch = Array(repeating: placeholder, count: Int(Swift.min(UInt32(batchSize), size - nextIndex)))
+            let fetched = Int(getMany(nextIndex, &batch))
+            guard fetched > 0 else { return nil }
+            batch.removeLast(batch.count - fetched)
+            nextIndex += UInt32(fetched)
+            position = 0
+        }
+
+        defer { position += 1 }
+        return batch[position]
+    }
+}
@@ -4,93 +4,102 @@ import WinSDK
 
 // Handwritten implementation for PropertyValue which *doesn't* try to do the IInspectable <-> Any mapping.
 // This class is used by the AnyWrapper to create IInspectable instances from this subset of known Any values.
+// The boxes are implemented in Swift rather than made by the Windows.Foundation.PropertyValue factory, so
+// boxing a value doesn't cost an activation factory call.
 internal final class PropertyValue {
-    private static let _IPropertyValueStatics: IPropertyValueStatics = try! RoGetActivationFactory("Windows.Foundation.PropertyValue")
+    // Boxes can't be changed once they're made, so the values which are boxed the most share theirs
+    private static let cachedIntegers: ClosedRange<Int> = -128...127
+    private static let booleanBoxes = [false, true].map(makeBoolean)
+    private static let int32Boxes = cachedIntegers.map { makeInt32(Int32($0)) }
+    private static let int64Boxes = cachedIntegers.map { makeInt64(Int64($0)) }
 
     public static func createUInt8(_ value: UInt8) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateUInt8Impl(value)
-        return .init(propertyValue!)
+        box(value, .uint8) { $0.storeBytes(of: value, as: UINT8.self) }
     }
 
     public static func createInt16(_ value: Int16) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateInt16Impl(value)
-        return .init(propertyValue!)
+        box(value, .int16) { $0.storeBytes(of: value, as: INT16.self) }
     }
 
     public static func createUInt16(_ value: UInt16) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateUInt16Impl(value)
-        return .init(propertyValue!)
+        box(value, .uint16) { $0.storeBytes(of: value, as: UINT16.self) }
     }
 
     public static func createInt32(_ value: Int32) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateInt32Impl(value)
-        return .init(propertyValue!)
+        guard cachedIntegers.contains(Int(value)) else { return makeInt32(value) }
+        return int32Boxes[Int(value) - cachedIntegers.lowerBound]
     }
 
     public static func createUInt32(_ value: UInt32) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateUInt32Impl(value)
-        return .init(propertyValue!)
+        box(value, .uint32) { $0.storeBytes(of: value, as: UINT32.self) }
     }
 
     public static func createInt64(_ value: Int64) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateInt64Impl(value)
-        return .init(propertyValue!)
+        guard cachedIntegers.contains(Int(value)) else { return makeInt64(value) }
+        return int64Boxes[Int(value) - cachedIntegers.lowerBound]
     }
 
     public static func createUInt64(_ value: UInt64) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateUInt64Impl(value)
-        return .init(propertyValue!)
+        box(value, .uint64) { $0.storeBytes(of: value, as: UINT64.self) }
     }
 
     public static func createSingle(_ value: Float) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateSingleImpl(value)
-        return .init(propertyValue!)
+        box(value, .single) { $0.storeBytes(of: value, as: FLOAT.self) }
     }
 
     public static func createDouble(_ value: Double) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateDoubleImpl(value)
-        return .init(propertyValue!)
+        box(value, .double) { $0.storeBytes(of: value, as: DOUBLE.self) }
     }
 
     public static func createBoolean(_ value: Bool) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateBooleanImpl(.init(from: value))
-        return .init(propertyValue!)
+        booleanBoxes[value ? 1 : 0]
     }
 
     public static func createString(_ value: String) -> WindowsFoundation.IInspectable {
-        let _value = try! HString(value)
-        let propertyValue = try! _IPropertyValueStatics.CreateStringImpl(_value.get())
-        return .init(propertyValue!)
+        box(value, .string) { $0.storeBytes(of: try! HString(value).detach(), as: HSTRING?.self) }
     }
 
     public static func createGuid(_ value: GUID) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateGuidImpl(value)
-        return .init(propertyValue!)
+        box(Foundation.UUID(from: value), .guid) { $0.storeBytes(of: value, as: GUID.self) }
     }
 
     public static func createDateTime(_ value: DateTime) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateDateTimeImpl(.from(swift: value))
-        return .init(propertyValue!)
+        box(value, .dateTime) { $0.storeBytes(of: .from(swift: value), as: __x_ABI_CWindows_CFoundation_CDateTime.self) }
     }
 
     public static func createTimeSpan(_ value: TimeSpan) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateTimeSpanImpl(.from(swift: value))
-        return .init(propertyValue!)
+        box(value, .timeSpan) { $0.storeBytes(of: .from(swift: value), as: __x_ABI_CWindows_CFoundation_CTimeSpan.self) }
     }
 
     public static func createPoint(_ value: Point) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreatePointImpl(.from(swift: value))
-        return .init(propertyValue!)
+        box(value, .point) { $0.storeBytes(of: .from(swift: value), as: __x_ABI_CWindows_CFoundation_CPoint.self) }
     }
 
     public static func createSize(_ value: Size) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateSizeImpl(.from(swift: value))
-        return .init(propertyValue!)
+        box(value, .size) { $0.storeBytes(of: .from(swift: value), as: __x_ABI_CWindows_CFoundation_CSize.self) }
     }
 
     public static func createRect(_ value: Rect) -> WindowsFoundation.IInspectable {
-        let propertyValue = try! _IPropertyValueStatics.CreateRectImpl(.from(swift: value))
-        return .init(propertyValue!)
+        box(value, .rect) { $0.storeBytes(of: .from(swift: value), as: __x_ABI_CWindows_CFoundation_CRect.self) }
+    }
+
+    private static func makeBoolean(_ value: Bool) -> WindowsFoundation.IInspectable {
+        box(value, .boolean) { $0.storeBytes(of: .init(from: value), as: boolean.self) }
+    }
+
+    private static func makeInt32(_ value: Int32) -> WindowsFoundation.IInspectable {
+        box(value, .int32) { $0.storeBytes(of: value, as: INT32.self) }
+    }
+
+    private static func makeInt64(_ value: Int64) -> WindowsFoundation.IInspectable {
+        box(value, .int64) { $0.storeBytes(of: value, as: INT64.self) }
+    }
+
+    private static func box(_ value: Any, _ type: BoxedType, getValue: @escaping (UnsafeMutableRawPointer) -> Void) -> WindowsFoundation.IInspectable {
+        let wrapper = __ABI_Windows_Foundation.IPropertyValueWrapper(PropertyValueBox(value, type, getValue))!
+        return try! wrapper.toABI { abi in
+            abi.withMemoryRebound(to: C_IInspectable.self, capacity: 1) { .init(ComPtr($0)) }
+        }
     }
 }
 
@@ -139,4 +148,147 @@ extension PropertyValue
             default: return nil
         }
     }
+
+    // Native property values convert between the numeric types when the value fits in the type asked for,
+    // and the numeric getters of IPropertyValueImpl go through these to do the same
+    static func number<Number: BinaryInteger>(_ value: Any) throws -> Number {
+        let result: Number? = switch value {
+            case let value as any BinaryInteger: Number(exactly: value)
+            case let value as any BinaryFloatingPoint: Number(exactly: value)
+            default: throw WindowsFoundation.Error(hr: TYPE_E_TYPEMISMATCH)
+        }
+        guard let result else { throw WindowsFoundation.Error(hr: DISP_E_OVERFLOW) }
+        return result
+    }
+
+    static func number<Number: BinaryFloatingPoint>(_ value: Any) throws -> Number {
+        let result: Number? = switch value {
+            case let value as any BinaryInteger: Number(exactly: value)
+            case let value as any BinaryFloatingPoint: Number(value)
+            default: throw WindowsFoundation.Error(hr: TYPE_E_TYPEMISMATCH)
+        }
+        guard let result else { throw WindowsFoundation.Error(hr: DISP_E_OVERFLOW) }
+        return result
+    }
 }
+
+// The IReference<T> which a box answers for, besides IPropertyValue
+fileprivate struct BoxedType {
+    let iid: WindowsFoundation.IID
+    let runtimeClassName: String
+
+    init(_ iid: WindowsFoundation.IID, _ typeName: String) {
+        self.iid = iid
+        self.runtimeClassName = "Windows.Foundation.IReference`1<\(typeName)>"
+    }
+
+    static let uint8 = BoxedType(.init(Data1: 0xE5198CC8, Data2: 0x2873, Data3: 0x55F5, Data4: (0xB0, 0xA1, 0x84, 0xFF, 0x9E, 0x4A, 0xAD, 0x62)), "UInt8") // e5198cc8-2873-55f5-b0a1-84ff9e4aad62
+    static let int16 = BoxedType(.init(Data1: 0x6EC9E41B, Data2: 0x6709, Data3: 0x5647, Data4: (0x99, 0x18, 0xA1, 0x27, 0x01, 0x10, 0xFC, 0x4E)), "Int16") // 6ec9e41b-6709-5647-9918-a1270110fc4e
+    static let uint16 = BoxedType(.init(Data1: 0x5AB7D2C3, Data2: 0x6B62, Data3: 0x5E71, Data4: (0xA4, 0xB6, 0x2D, 0x49, 0xC4, 0xF2, 0x38, 0xFD)), "UInt16") // 5ab7d2c3-6b62-5e71-a4b6-2d49c4f238fd
+    static let int32 = BoxedType(.init(Data1: 0x548CEFBD, Data2: 0xBC8A, Data3: 0x5FA0, Data4: (0x8D, 0xF2, 0x95, 0x74, 0x40, 0xFC, 0x8B, 0xF4)), "Int32") // 548cefbd-bc8a-5fa0-8df2-957440fc8bf4
+    static let uint32 = BoxedType(.init(Data1: 0x513EF3AF, Data2: 0xE784, Data3: 0x5325, Data4: (0xA9, 0x1E, 0x97, 0xC2, 0xB8, 0x11, 0x1C, 0xF3)), "UInt32") // 513ef3af-e784-5325-a91e-97c2b8111cf3
+    static let int64 = BoxedType(.init(Data1: 0x4DDA9E24, Data2: 0xE69F, Data3: 0x5C6A, Data4: (0xA0, 0xA6, 0x93, 0x42, 0x73, 0x65, 0xAF, 0x2A)), "Int64") // 4dda9e24-e69f-5c6a-a0a6-93427365af2a
+    static let uint64 = BoxedType(.init(Data1: 0x6755E376, Data2: 0x53BB, Data3: 0x568B, Data4: (0xA1, 0x1D, 0x17, 0x23, 0x98, 0x68, 0x30, 0x9E)), "UInt64") // 6755e376-53bb-568b-a11d-17239868309e
+    static let single = BoxedType(.init(Data1: 0x719CC2BA, Data2: 0x3E76, Data3: 0x5DEF, Data4: (0x9F, 0x1A, 0x38, 0xD8, 0x5A, 0x14, 0x5E, 0xA8)), "Single") // 719cc2ba-3e76-5def-9f1a-38d85a145ea8
+    static let double = BoxedType(.init(Data1: 0x2F2D6C29, Data2: 0x5473, Data3: 0x5F3E, Data4: (0x92, 0xE7, 0x96, 0x57, 0x2B, 0xB9, 0x90, 0xE2)), "Double") // 2f2d6c29-5473-5f3e-92e7-96572bb990e2
+    static let boolean = BoxedType(.init(Data1: 0x3C00FD60, Data2: 0x2950, Data3: 0x5939, Data4: (0xA2, 0x1A, 0x2D, 0x12, 0xC5, 0xA0, 0x1B, 0x8A)), "Boolean") // 3c00fd60-2950-5939-a21a-2d12c5a01b8a
+    static let string = BoxedType(.init(Data1: 0xFD416DFB, Data2: 0x2A07, Data3: 0x52EB, Data4: (0xAA, 0xE3, 0xDF, 0xCE, 0x14, 0x11, 0x6C, 0x05)), "String") // fd416dfb-2a07-52eb-aae3-dfce14116c05
+    static let guid = BoxedType(.init(Data1: 0x7D50F649, Data2: 0x632C, Data3: 0x51F9, Data4: (0x84, 0x9A, 0xEE, 0x49, 0x42, 0x89, 0x33, 0xEA)), "Guid") // 7d50f649-632c-51f9-849a-ee49428933ea
+    static let dateTime = BoxedType(.init(Data1: 0x5541D8A7, Data2: 0x497C, Data3: 0x5AA4, Data4: (0x86, 0xFC, 0x77, 0x13, 0xAD, 0xBF, 0x2A, 0x2C)), "Windows.Foundation.DateTime") // 5541d8a7-497c-5aa4-86fc-7713adbf2a2c
+    static let timeSpan = BoxedType(.init(Data1: 0x604D0C4C, Data2: 0x91DE, Data3: 0x5C2A, Data4: (0x93, 0x5F, 0x36, 0x2F, 0x13, 0xEA, 0xF8, 0x00)), "Windows.Foundation.TimeSpan") // 604d0c4c-91de-5c2a-935f-362f13eaf800
+    static let point = BoxedType(.init(Data1: 0x84F14C22, Data2: 0xA00A, Data3: 0x5272, Data4: (0x8D, 0x3D, 0x82, 0x11, 0x2E, 0x66, 0xDF, 0x00)), "Windows.Foundation.Point") // 84f14c22-a00a-5272-8d3d-82112e66df00
+    static let size = BoxedType(.init(Data1: 0x61723086, Data2: 0x8E53, Data3: 0x5276, Data4: (0x9F, 0x36, 0x2A, 0x4B, 0xB9, 0x3E, 0x2B, 0x75)), "Windows.Foundation.Size") // 61723086-8e53-5276-9f36-2a4bb93e2b75
+    static let rect = BoxedType(.init(Data1: 0x80423F11, Data2: 0x054F, Data3: 0x5EAC, Data4: (0xAF, 0xD3, 0x63, 0xB6, 0xCE, 0x15, 0xE7, 0x7B)), "Windows.Foundation.Rect") // 80423f11-054f-5eac-afd3-63b6ce15e77b
+}
+
+// The Swift object behind a boxed value. IPropertyValueImpl answers IPropertyValue, and this adds the
+// IReference<T> for the type of the value.
+internal final class PropertyValueBox: __IMPL_Windows_Foundation.IPropertyValueImpl {
+    fileprivate let boxedType: BoxedType
+    // Writes the value out as the ABI type of T
+    fileprivate let getValue: (UnsafeMutableRawPointer) -> Void
+
+    fileprivate init(_ value: Any, _ boxedType: BoxedType, _ getValue: @escaping (UnsafeMutableRawPointer) -> Void) {
+        self.boxedType = boxedType
+        self.getValue = getValue
+        super.init(value: value)
+    }
+
+    override public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
+        guard iid == boxedType.iid else { return super.queryInterface(iid) }
+        return ReferenceBoxWrapper(self).queryInterface(iid)
+    }
+}
+
+// IPropertyValue is already implemented in Swift for the boxes, the IReference<T> part has a vtable of its own
+// which is shared between all of the Ts.
+fileprivate let IID_IReference: WindowsFoundation.IID = .init(Data1: 0x61C17706, Data2: 0x2D65, Data3: 0x11E0, Data4: (0x9A, 0xE8, 0xD4, 0x85, 0x64, 0x01, 0x54, 0x72)) // 61c17706-2d65-11e0-9ae8-d48564015472
+
+fileprivate final class ReferenceBoxWrapper: WinRTAbiBridgeWrapper<ReferenceBoxBridge> {
+    // The uninstantiated IReference`1, which nothing asks for. queryInterface answers for the instantiation
+    // of the box it wraps.
+    override class var IID: WindowsFoundation.IID { IID_IReference }
+
+    init(_ box: PropertyValueBox) {
+        super.init(ReferenceBoxBridge.makeAbi(), box)
+    }
+
+    override class func queryInterface(_ pUnk: UnsafeMutablePointer<IReferenceBox>?, _ riid: UnsafePointer<WindowsFoundation.IID>?, _ ppvObject: UnsafeMutablePointer<UnsafeMutableRawPointer?>?) -> HRESULT {
+        guard let pUnk, let riid, let ppvObject else { return E_INVALIDARG }
+        guard let box = tryUnwrapFromBase(raw: pUnk), riid.pointee == box.boxedType.iid else {
+            return super.queryInterface(pUnk, riid, ppvObject)
+        }
+        _ = addRef(pUnk)
+        ppvObject.pointee = UnsafeMutableRawPointer(pUnk)
+        return S_OK
+    }
+}
+
+fileprivate enum ReferenceBoxBridge: AbiBridge {
+    typealias CABI = IReferenceBox
+    typealias SwiftProjection = PropertyValueBox
+
+    static func makeAbi() -> IReferenceBox {
+        return IReferenceBox(lpVtbl: &ReferenceBoxVTable)
+    }
+
+    static func from(abi: consuming ComPtr<IReferenceBox>?) -> PropertyValueBox? {
+        fatalError("Not needed")
+    }
+}
+
+fileprivate var ReferenceBoxVTable: IReferenceBoxVtbl = .init(
+    QueryInterface: { ReferenceBoxWrapper.queryInterface($0, $1, $2) },
+    AddRef: { ReferenceBoxWrapper.addRef($0) },
+    Release: { ReferenceBoxWrapper.release($0) },
+    GetIids: {
+        guard let box = ReferenceBoxWrapper.tryUnwrapFromBase(raw: $0) else { return E_INVALIDARG }
+        let size = MemoryLayout<WindowsFoundation.IID>.size
+        let iids = CoTaskMemAlloc(UInt64(size) * 4).assumingMemoryBound(to: WindowsFoundation.IID.self)
+        iids[0] = IUnknown.IID
+        iids[1] = IInspectable.IID
+        iids[2] = box.boxedType.iid
+        iids[3] = __ABI_Windows_Foundation.IPropertyValueWrapper.IID
+        $1!.pointee = 4
+        $2!.pointee = iids
+        return S_OK
+    },
+
+    GetRuntimeClassName: {
+        guard let box = ReferenceBoxWrapper.tryUnwrapFromBase(raw: $0) else { return E_INVALIDARG }
+        $1!.pointee = try! HString(box.boxedType.runtimeClassName).detach()
+        return S_OK
+    },
+
+    GetTrustLevel: {
+        _ = $0
+        $1!.pointee = TrustLevel(rawValue: 0)
+        return S_OK
+    },
+
+    get_Value: {
+        guard let box = ReferenceBoxWrapper.tryUnwrapFromBase(raw: $0), let value = $1 else { return E_INVALIDARG }
+        box.getValue(value)
+        return S_OK
+    }
+)
@@ -31,6 +31,16 @@ public func RoGetActivationFactory<Factory: IInspectable>(_ activatableClassId:
   return try factory!.queryInterface()
 }
 
+public func RoGetActivationFactory<Factory: IInspectable>(_ activatableClassId: String) throws -> Factory {
+  var iid = Factory.IID
+  let (factory) = try ComPtrs.initialize(to: C_IInspectable.self) { factoryAbi in
+    try activatableClassId.withHStringRef { activatableClassIdHStr in
+      try CHECKED(RoGetActivationFactory(activatableClassIdHStr, &iid, &factoryAbi))
+    }
+  }
+  return try factory!.queryInterface()
+}
+
 
 // ISwiftImplemented is a marker interface for code-gen types which are created by swift/winrt. It's used to QI
 // an IUnknown VTABLE to see whether we can unwrap this type as a known swift object. The class is marked final
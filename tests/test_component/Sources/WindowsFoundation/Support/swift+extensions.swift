@@ -16,11 +16,28 @@ extension String {
     self.init(decoding: UnsafeBufferPointer(start: pwszBuffer, count: Int(length)), as: UTF16.self)
   }
 
+  // Passes the string as a fast-pass reference, which doesn't allocate an HSTRING. Strings which fit are transcoded
+  // into a buffer on the stack, longer ones go through a temporary UTF-16 copy.
   public func withHStringRef(_ body: (HSTRING?) throws -> Void) rethrows {
-    try self.withCString(encodedAs: UTF16.self) {
+    let length = utf16.count
+    guard length < MemoryLayout<CWinRT.StaticWCharArray_512>.size / MemoryLayout<WCHAR>.size else {
+      try self.withCString(encodedAs: UTF16.self) {
+        var hString: HSTRING?
+        var header: HSTRING_HEADER = .init()
+        try CHECKED(WindowsCreateStringReference($0, UInt32(length), &header, &hString))
+        try body(hString)
+      }
+      return
+    }
+
+    // the buffer is zeroed, so the reference is null terminated as long as there is room left after the string
+    var buffer: CWinRT.StaticWCharArray_512 = .init()
+    try withUnsafeMutableBytes(of: &buffer.Data) { bytes in
+      let chars = bytes.assumingMemoryBound(to: WCHAR.self)
+      _ = chars.initialize(from: utf16)
       var hString: HSTRING?
       var header: HSTRING_HEADER = .init()
-      try CHECKED(WindowsCreateStringReference($0, UInt32(wcslen($0)), &header, &hString))
+      try CHECKED(WindowsCreateStringReference(chars.baseAddress, UInt32(length), &header, &hString))
       try body(hString)
     }
   }
@@ -12,3 +12,31 @@ public protocol FromAbi {
 
 @_spi(WinRTInternal)
 public typealias WinRTBridgeable = ToAbi & FromAbi
+
+/// A struct whose fields are all numbers, enums or other blittable structs. When its Swift layout matches
+/// the C layout of its ABI struct, it's converted to and from the ABI with a single copy, and arrays of it
+/// are passed as a single block of memory.
+@_spi(WinRTInternal)
+public protocol WinRTBlittableStruct: WinRTBridgeable {
+    static var hasAbiLayout: Bool { get }
+}
+
+@_spi(WinRTInternal)
+extension WinRTBlittableStruct {
+    // Only valid when hasAbiLayout is true. The layouts are constants, so checking first costs nothing once
+    // optimized. A Swift struct doesn't include its tail padding in its size, so can be smaller than the ABI.
+    @_alwaysEmitIntoClient @inline(__always)
+    public static func copy(fromABI abi: ABI) -> Self {
+        withUnsafeBytes(of: abi) { $0.loadUnaligned(as: Self.self) }
+    }
+
+    @_alwaysEmitIntoClient @inline(__always)
+    public func copyToABI() -> ABI {
+        withUnsafeTemporaryAllocation(of: ABI.self, capacity: 1) { buffer in
+            let abi = UnsafeMutableRawPointer(buffer.baseAddress!)
+            abi.initializeMemory(as: UInt8.self, repeating: 0, count: MemoryLayout<ABI>.size)
+            abi.storeBytes(of: self, as: Self.self)
+            return abi.load(as: ABI.self)
+        }
+    }
+}
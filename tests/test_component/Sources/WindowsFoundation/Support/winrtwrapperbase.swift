@@ -1,4 +1,5 @@
 import CWinRT
+import Synchronization
 import WinSDK
 
 public protocol Initializable {
@@ -50,6 +51,8 @@ internal typealias AnyAbiInterfaceImpl<Bridge> = any AbiInterfaceImpl<Bridge>
 public protocol WinRTAbiImpl<Bridge>: AbiInterfaceImpl where Bridge.SwiftABI: IInspectable {}
 internal typealias AnyWinRTAbiImpl<Bridge> = any WinRTAbiImpl<Bridge>
 
+// Implemented by the objects of wrappers whose references through the ABI also have to be counted
+// somewhere else. The vtables of these wrappers go through addRefAggregated and releaseAggregated.
 internal protocol CustomAddRef {
     func addRef()
     func release()
@@ -65,6 +68,9 @@ open class WinRTWrapperBase<CInterface, Prototype> {
 
     public var instance: ComObjectABI
     public var swiftObj: Prototype!
+    // References held through the ABI. The wrapper keeps a single Swift reference to itself while there are
+    // any, which is only taken and dropped on the 0 <-> 1 transitions.
+    private let comRefCount = Atomic<UInt32>(0)
 
     open class var IID: WindowsFoundation.IID { get { fatalError("not implemented") } }
 
@@ -135,24 +141,26 @@ open class WinRTWrapperBase<CInterface, Prototype> {
 
     public static func addRef(_ pUnk: UnsafeMutablePointer<CInterface>?) -> ULONG {
         guard let unmanaged = fromRaw(pUnk) else { return 1 }
-        let wrapper = unmanaged.takeUnretainedValue()
-        _ = unmanaged.retain()
-
-        if let customAddRef = wrapper.swiftObj as? CustomAddRef {
-            customAddRef.addRef()
+        let count = unmanaged._withUnsafeGuaranteedRef {
+            $0.comRefCount.wrappingAdd(1, ordering: .relaxed).newValue
+        }
+        if count == 1 {
+            _ = unmanaged.retain()
         }
-        return ULONG(_getRetainCount(wrapper))
+        return count
     }
 
     public static func release(_ pUnk: UnsafeMutablePointer<CInterface>?) -> ULONG {
         guard let unmanaged = fromRaw(pUnk) else { return 1 }
-        let wrapper = unmanaged.takeUnretainedValue()
-        unmanaged.release()
-
-        if let customAddRef = wrapper.swiftObj as? CustomAddRef {
-            customAddRef.release()
+        let (oldCount, count) = unmanaged._withUnsafeGuaranteedRef {
+            $0.comRefCount.wrappingSubtract(1, ordering: .acquiringAndReleasing)
+        }
+        // the subtraction wraps, so an unbalanced Release would otherwise go unnoticed until the object is freed twice
+        precondition(oldCount != 0, "Release called on a WinRT object which has no references left")
+        if count == 0 {
+            unmanaged.release()
         }
-        return ULONG(_getRetainCount(wrapper))
+        return count
     }
 
     fileprivate static func queryInterfaceBase(_ pUnk: UnsafeMutablePointer<CInterface>, _ riid: UnsafePointer<WindowsFoundation.IID>, _ result: UnsafeMutablePointer<UnsafeMutableRawPointer?>) -> HRESULT {
@@ -186,14 +194,23 @@ open class WinRTAbiBridgeWrapper<I: AbiBridge> : WinRTWrapperBase<I.CABI, I.Swif
     open class func queryInterface(_ pUnk: UnsafeMutablePointer<I.CABI>?, _ riid: UnsafePointer<WindowsFoundation.IID>?, _ ppvObject: UnsafeMutablePointer<UnsafeMutableRawPointer?>?) -> HRESULT {
         guard let pUnk, let riid, let ppvObject else { return E_INVALIDARG }
         ppvObject.pointee = nil
-         switch riid.pointee {
-            case IUnknown.IID, IInspectable.IID, ISwiftImplemented.IID, IAgileObject.IID, Self.IID:
-                _ = addRef(pUnk)
-                ppvObject.pointee = UnsafeMutableRawPointer(pUnk)
-                return S_OK
-            default:
-                return super.queryInterfaceBase(pUnk, riid, ppvObject)
+        // Every object answers for these, so switch on Data1 (distinct for each of them) instead of
+        // comparing against each IID in turn, and only compare the whole IID it picks out
+        let iid = riid.pointee
+        let isIdentity: Bool
+        switch iid.Data1 {
+            case 0x00000000: isIdentity = iid == IUnknown.IID
+            case 0xAF86E2E0: isIdentity = iid == IInspectable.IID
+            case 0xBFD14AD5: isIdentity = iid == ISwiftImplemented.IID
+            case 0x94EA2B94: isIdentity = iid == IAgileObject.IID
+            default: isIdentity = false
+        }
+        guard isIdentity || iid == Self.IID else {
+            return super.queryInterfaceBase(pUnk, riid, ppvObject)
         }
+        _ = addRef(pUnk)
+        ppvObject.pointee = UnsafeMutableRawPointer(pUnk)
+        return S_OK
     }
 }
 
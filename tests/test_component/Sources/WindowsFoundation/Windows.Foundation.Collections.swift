@@ -260,21 +260,30 @@ public protocol IPropertySet : IObservableMap<String, Any?>, IMap<String, Any?>,
 
 extension IPropertySet {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Foundation_Collections.IPropertySetWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation_Collections.IPropertySetWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case WindowsFoundation.__x_ABI_C__FIObservableMap_2_HSTRING_IInspectableWrapper.IID:
-                let wrapper = WindowsFoundation.__x_ABI_C__FIObservableMap_2_HSTRING_IInspectableWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case WindowsFoundation.__x_ABI_C__FIMap_2_HSTRING_IInspectableWrapper.IID:
-                let wrapper = WindowsFoundation.__x_ABI_C__FIMap_2_HSTRING_IInspectableWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case WindowsFoundation.__x_ABI_C__FIIterable_1___x_ABI_C__FIKeyValuePair_2_HSTRING_IInspectableWrapper.IID:
-                let wrapper = WindowsFoundation.__x_ABI_C__FIIterable_1___x_ABI_C__FIKeyValuePair_2_HSTRING_IInspectableWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x1B0D3570:
+                if iid == WindowsFoundation.__x_ABI_C__FIMap_2_HSTRING_IInspectableWrapper.IID {
+                    let wrapper = WindowsFoundation.__x_ABI_C__FIMap_2_HSTRING_IInspectableWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x236AAC9D:
+                if iid == WindowsFoundation.__x_ABI_C__FIObservableMap_2_HSTRING_IInspectableWrapper.IID {
+                    let wrapper = WindowsFoundation.__x_ABI_C__FIObservableMap_2_HSTRING_IInspectableWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x8A43ED9F:
+                if iid == __ABI_Windows_Foundation_Collections.IPropertySetWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation_Collections.IPropertySetWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0xFE2F3D47:
+                if iid == WindowsFoundation.__x_ABI_C__FIIterable_1___x_ABI_C__FIKeyValuePair_2_HSTRING_IInspectableWrapper.IID {
+                    let wrapper = WindowsFoundation.__x_ABI_C__FIIterable_1___x_ABI_C__FIKeyValuePair_2_HSTRING_IInspectableWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIPropertySet = any IPropertySet
@@ -313,12 +322,13 @@ extension __IMPL_Windows_Foundation_Collections {
         /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.foundation.collections.ipropertyset.mapchanged)
         fileprivate lazy var mapChanged : Event<MapChangedEventHandler<String, Any?>> = {
           .init(
+            bridge: WindowsFoundation.__x_ABI_C__FMapChangedEventHandler_2_HSTRING_IInspectableBridge.self,
             add: { [weak self] in
               guard let this = self?._IObservableMap else { return .init() }
-              return try! this.add_MapChanged($0)
+              return try this.add_MapChanged($0)
             },
             remove: { [weak self] in
-             try? self?._IObservableMap.remove_MapChanged($0)
+             try self?._IObservableMap.remove_MapChanged($0)
            }
           )
         }()
@@ -433,12 +443,15 @@ public protocol IVectorChangedEventArgs : WinRTInterface {
 
 extension IVectorChangedEventArgs {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Foundation_Collections.IVectorChangedEventArgsWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation_Collections.IVectorChangedEventArgsWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x575933DF:
+                if iid == __ABI_Windows_Foundation_Collections.IVectorChangedEventArgsWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation_Collections.IVectorChangedEventArgsWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIVectorChangedEventArgs = any IVectorChangedEventArgs
@@ -672,12 +685,13 @@ public final class PropertySet : WinRTClass, IObservableMap, IMap, IIterable, IP
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.foundation.collections.propertyset.mapchanged)
     public lazy var mapChanged : Event<MapChangedEventHandler<String, Any?>> = {
       .init(
+        bridge: WindowsFoundation.__x_ABI_C__FMapChangedEventHandler_2_HSTRING_IInspectableBridge.self,
         add: { [weak self] in
           guard let this = self?._IObservableMap else { return .init() }
-          return try! this.add_MapChanged($0)
+          return try this.add_MapChanged($0)
         },
         remove: { [weak self] in
-         try? self?._IObservableMap.remove_MapChanged($0)
+         try self?._IObservableMap.remove_MapChanged($0)
        }
       )
     }()
@@ -832,12 +846,13 @@ public final class StringMap : WinRTClass, IMap, IIterable, IObservableMap {
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.foundation.collections.stringmap.mapchanged)
     public lazy var mapChanged : Event<MapChangedEventHandler<String, String>> = {
       .init(
+        bridge: WindowsFoundation.__x_ABI_C__FMapChangedEventHandler_2_HSTRING_HSTRINGBridge.self,
         add: { [weak self] in
           guard let this = self?._IObservableMap else { return .init() }
-          return try! this.add_MapChanged($0)
+          return try this.add_MapChanged($0)
         },
         remove: { [weak self] in
-         try? self?._IObservableMap.remove_MapChanged($0)
+         try self?._IObservableMap.remove_MapChanged($0)
        }
       )
     }()
@@ -908,12 +923,13 @@ public final class ValueSet : WinRTClass, IObservableMap, IMap, IIterable, IProp
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.foundation.collections.valueset.mapchanged)
     public lazy var mapChanged : Event<MapChangedEventHandler<String, Any?>> = {
       .init(
+        bridge: WindowsFoundation.__x_ABI_C__FMapChangedEventHandler_2_HSTRING_IInspectableBridge.self,
         add: { [weak self] in
           guard let this = self?._IObservableMap else { return .init() }
-          return try! this.add_MapChanged($0)
+          return try this.add_MapChanged($0)
         },
         remove: { [weak self] in
-         try? self?._IObservableMap.remove_MapChanged($0)
+         try self?._IObservableMap.remove_MapChanged($0)
        }
       )
     }()
@@ -174,16 +174,30 @@ public struct DateTime: Hashable, Codable, Sendable {
 extension DateTime: WinRTBridgeable {
     public typealias ABI = __x_ABI_CWindows_CFoundation_CDateTime
     public static func from(abi: ABI) -> Self {
-        .init(universalTime: abi.UniversalTime)
+        guard hasAbiLayout else {
+            return .init(universalTime: abi.UniversalTime)
+        }
+        return copy(fromABI: abi)
     }
     public func toABI() -> ABI {
         .from(swift: self)
     }
 }
 
+@_spi(WinRTInternal)
+extension DateTime: WinRTBlittableStruct {
+    public static var hasAbiLayout: Bool {
+        MemoryLayout<Self>.stride == MemoryLayout<ABI>.stride &&
+            MemoryLayout<Self>.offset(of: \.universalTime) == MemoryLayout<ABI>.offset(of: \.UniversalTime)
+    }
+}
+
 extension __x_ABI_CWindows_CFoundation_CDateTime {
     public static func from(swift: WindowsFoundation.DateTime) -> __x_ABI_CWindows_CFoundation_CDateTime {
-        .init(UniversalTime: swift.universalTime)
+        guard WindowsFoundation.DateTime.hasAbiLayout else {
+            return .init(UniversalTime: swift.universalTime)
+        }
+        return swift.copyToABI()
     }
 }
 // MARK: - Point
@@ -207,16 +221,31 @@ public struct Point: Hashable, Codable, Sendable {
 extension Point: WinRTBridgeable {
     public typealias ABI = __x_ABI_CWindows_CFoundation_CPoint
     public static func from(abi: ABI) -> Self {
-        .init(x: abi.X, y: abi.Y)
+        guard hasAbiLayout else {
+            return .init(x: abi.X, y: abi.Y)
+        }
+        return copy(fromABI: abi)
     }
     public func toABI() -> ABI {
         .from(swift: self)
     }
 }
 
+@_spi(WinRTInternal)
+extension Point: WinRTBlittableStruct {
+    public static var hasAbiLayout: Bool {
+        MemoryLayout<Self>.stride == MemoryLayout<ABI>.stride &&
+            MemoryLayout<Self>.offset(of: \.x) == MemoryLayout<ABI>.offset(of: \.X) &&
+            MemoryLayout<Self>.offset(of: \.y) == MemoryLayout<ABI>.offset(of: \.Y)
+    }
+}
+
 extension __x_ABI_CWindows_CFoundation_CPoint {
     public static func from(swift: WindowsFoundation.Point) -> __x_ABI_CWindows_CFoundation_CPoint {
-        .init(X: swift.x, Y: swift.y)
+        guard WindowsFoundation.Point.hasAbiLayout else {
+            return .init(X: swift.x, Y: swift.y)
+        }
+        return swift.copyToABI()
     }
 }
 // MARK: - Rect
@@ -246,16 +275,33 @@ public struct Rect: Hashable, Codable, Sendable {
 extension Rect: WinRTBridgeable {
     public typealias ABI = __x_ABI_CWindows_CFoundation_CRect
     public static func from(abi: ABI) -> Self {
-        .init(x: abi.X, y: abi.Y, width: abi.Width, height: abi.Height)
+        guard hasAbiLayout else {
+            return .init(x: abi.X, y: abi.Y, width: abi.Width, height: abi.Height)
+        }
+        return copy(fromABI: abi)
     }
     public func toABI() -> ABI {
         .from(swift: self)
     }
 }
 
+@_spi(WinRTInternal)
+extension Rect: WinRTBlittableStruct {
+    public static var hasAbiLayout: Bool {
+        MemoryLayout<Self>.stride == MemoryLayout<ABI>.stride &&
+            MemoryLayout<Self>.offset(of: \.x) == MemoryLayout<ABI>.offset(of: \.X) &&
+            MemoryLayout<Self>.offset(of: \.y) == MemoryLayout<ABI>.offset(of: \.Y) &&
+            MemoryLayout<Self>.offset(of: \.width) == MemoryLayout<ABI>.offset(of: \.Width) &&
+            MemoryLayout<Self>.offset(of: \.height) == MemoryLayout<ABI>.offset(of: \.Height)
+    }
+}
+
 extension __x_ABI_CWindows_CFoundation_CRect {
     public static func from(swift: WindowsFoundation.Rect) -> __x_ABI_CWindows_CFoundation_CRect {
-        .init(X: swift.x, Y: swift.y, Width: swift.width, Height: swift.height)
+        guard WindowsFoundation.Rect.hasAbiLayout else {
+            return .init(X: swift.x, Y: swift.y, Width: swift.width, Height: swift.height)
+        }
+        return swift.copyToABI()
     }
 }
 // MARK: - Size
@@ -279,16 +325,31 @@ public struct Size: Hashable, Codable, Sendable {
 extension Size: WinRTBridgeable {
     public typealias ABI = __x_ABI_CWindows_CFoundation_CSize
     public static func from(abi: ABI) -> Self {
-        .init(width: abi.Width, height: abi.Height)
+        guard hasAbiLayout else {
+            return .init(width: abi.Width, height: abi.Height)
+        }
+        return copy(fromABI: abi)
     }
     public func toABI() -> ABI {
         .from(swift: self)
     }
 }
 
+@_spi(WinRTInternal)
+extension Size: WinRTBlittableStruct {
+    public static var hasAbiLayout: Bool {
+        MemoryLayout<Self>.stride == MemoryLayout<ABI>.stride &&
+            MemoryLayout<Self>.offset(of: \.width) == MemoryLayout<ABI>.offset(of: \.Width) &&
+            MemoryLayout<Self>.offset(of: \.height) == MemoryLayout<ABI>.offset(of: \.Height)
+    }
+}
+
 extension __x_ABI_CWindows_CFoundation_CSize {
     public static func from(swift: WindowsFoundation.Size) -> __x_ABI_CWindows_CFoundation_CSize {
-        .init(Width: swift.width, Height: swift.height)
+        guard WindowsFoundation.Size.hasAbiLayout else {
+            return .init(Width: swift.width, Height: swift.height)
+        }
+        return swift.copyToABI()
     }
 }
 // MARK: - TimeSpan
@@ -309,16 +370,30 @@ public struct TimeSpan: Hashable, Codable, Sendable {
 extension TimeSpan: WinRTBridgeable {
     public typealias ABI = __x_ABI_CWindows_CFoundation_CTimeSpan
     public static func from(abi: ABI) -> Self {
-        .init(duration: abi.Duration)
+        guard hasAbiLayout else {
+            return .init(duration: abi.Duration)
+        }
+        return copy(fromABI: abi)
     }
     public func toABI() -> ABI {
         .from(swift: self)
     }
 }
 
+@_spi(WinRTInternal)
+extension TimeSpan: WinRTBlittableStruct {
+    public static var hasAbiLayout: Bool {
+        MemoryLayout<Self>.stride == MemoryLayout<ABI>.stride &&
+            MemoryLayout<Self>.offset(of: \.duration) == MemoryLayout<ABI>.offset(of: \.Duration)
+    }
+}
+
 extension __x_ABI_CWindows_CFoundation_CTimeSpan {
     public static func from(swift: WindowsFoundation.TimeSpan) -> __x_ABI_CWindows_CFoundation_CTimeSpan {
-        .init(Duration: swift.duration)
+        guard WindowsFoundation.TimeSpan.hasAbiLayout else {
+            return .init(Duration: swift.duration)
+        }
+        return swift.copyToABI()
     }
 }
 // MARK: - AsyncActionCompletedHandler
@@ -491,15 +566,20 @@ public protocol IAsyncAction : IAsyncInfo {
 
 extension IAsyncAction {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Foundation.IAsyncActionWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IAsyncActionWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Foundation.IAsyncInfoWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IAsyncInfoWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x00000036:
+                if iid == __ABI_Windows_Foundation.IAsyncInfoWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IAsyncInfoWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x5A648006:
+                if iid == __ABI_Windows_Foundation.IAsyncActionWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IAsyncActionWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIAsyncAction = any IAsyncAction
@@ -507,11 +587,7 @@ public typealias AnyIAsyncAction = any IAsyncAction
 public extension IAsyncAction {
     func get() async throws {
         if status == .started {
-            let event = WaitableEvent()
-            completed = { _, _ in
-                Task { await event.signal() }
-            }
-            await event.wait()
+            try await waitForCompletion { resume in completed = { _, _ in resume() } }
         }
         return try getResults()
     }
@@ -699,12 +775,15 @@ public protocol IAsyncInfo : WinRTInterface {
 
 extension IAsyncInfo {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Foundation.IAsyncInfoWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IAsyncInfoWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x00000036:
+                if iid == __ABI_Windows_Foundation.IAsyncInfoWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IAsyncInfoWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIAsyncInfo = any IAsyncInfo
@@ -906,14 +985,18 @@ public typealias AnyIAsyncOperationWithProgress<TResult,TProgress> = any IAsyncO
 public extension IAsyncOperationWithProgress {
     func get() async throws -> TResult {
         if status == .started {
-            let event = WaitableEvent()
-            completed = { _, _ in
-                Task { await event.signal() }
-            }
-            await event.wait()
+            try await waitForCompletion { resume in completed = { _, _ in resume() } }
         }
         return try getResults()
     }
+
+    /// The progress reported by the operation, ending once it completes. This can be iterated alongside `get()`,
+    /// and more than once. Cancelling the iterating task cancels the operation, breaking out of the loop doesn't.
+    func progressUpdates() -> AsyncProgressUpdates<TProgress> {
+        makeProgressUpdates(
+            setProgress: { report in progress = { _, value in report(value) } },
+            setCompleted: { complete in completed = { _, _ in complete() } })
+    }
 }
 
 // MARK: - IAsyncOperationWithProgress Internals
@@ -944,11 +1027,7 @@ public typealias AnyIAsyncOperation<TResult> = any IAsyncOperation<TResult>
 public extension IAsyncOperation {
     func get() async throws -> TResult {
         if status == .started {
-            let event = WaitableEvent()
-            completed = { _, _ in
-                Task { await event.signal() }
-            }
-            await event.wait()
+            try await waitForCompletion { resume in completed = { _, _ in resume() } }
         }
         return try getResults()
     }
@@ -976,12 +1055,15 @@ public protocol IClosable : WinRTInterface {
 
 extension IClosable {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Foundation.IClosableWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x30D5A829:
+                if iid == __ABI_Windows_Foundation.IClosableWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIClosable = any IClosable
@@ -1095,15 +1177,20 @@ public protocol IMemoryBuffer : IClosable {
 
 extension IMemoryBuffer {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Foundation.IMemoryBufferWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IMemoryBufferWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Foundation.IClosableWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x30D5A829:
+                if iid == __ABI_Windows_Foundation.IClosableWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0xFBC4DD2A:
+                if iid == __ABI_Windows_Foundation.IMemoryBufferWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IMemoryBufferWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIMemoryBuffer = any IMemoryBuffer
@@ -1231,18 +1318,25 @@ public protocol IMemoryBufferReference : IClosable, IMemoryBufferByteAccess {
 
 extension IMemoryBufferReference {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Foundation.IMemoryBufferReferenceWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IMemoryBufferReferenceWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_Windows_Foundation.IClosableWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_.IMemoryBufferByteAccessWrapper.IID:
-                let wrapper = __ABI_.IMemoryBufferByteAccessWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x30D5A829:
+                if iid == __ABI_Windows_Foundation.IClosableWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IClosableWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0x5B0D3235:
+                if iid == __ABI_.IMemoryBufferByteAccessWrapper.IID {
+                    let wrapper = __ABI_.IMemoryBufferByteAccessWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0xFBC4DD29:
+                if iid == __ABI_Windows_Foundation.IMemoryBufferReferenceWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IMemoryBufferReferenceWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 extension IMemoryBufferReference {
@@ -1288,12 +1382,13 @@ extension __IMPL_Windows_Foundation {
         /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.foundation.imemorybufferreference.closed)
         fileprivate lazy var closed : Event<TypedEventHandler<IMemoryBufferReference?, Any?>> = {
           .init(
+            bridge: WindowsFoundation.__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CFoundation__CIMemoryBufferReference_IInspectableBridge.self,
             add: { [weak self] in
               guard let this = self?._default else { return .init() }
-              return try! this.add_Closed($0)
+              return try this.add_Closed($0)
             },
             remove: { [weak self] in
-             try? self?._default.remove_Closed($0)
+             try self?._default.remove_Closed($0)
            }
           )
         }()
@@ -1341,6 +1436,15 @@ extension __ABI_Windows_Foundation {
             return cookie
         }
 
+        @_spi(WinRTInternal)
+        public func add_Closed(_ handler: UnsafeMutablePointer<__x_ABI_C__FITypedEventHandler_2___x_ABI_CWindows__CFoundation__CIMemoryBufferReference_IInspectable>?) throws -> EventRegistrationToken {
+            var cookie: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_CWindows_CFoundation_CIMemoryBufferReference.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_Closed(pThis, handler, &cookie))
+            }
+            return cookie
+        }
+
         open func remove_Closed(_ cookie: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_CWindows_CFoundation_CIMemoryBufferReference.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_Closed(pThis, cookie))
@@ -1579,15 +1683,15 @@ extension __IMPL_Windows_Foundation {
 
         public var value: Any { _value }
 
-        public func getUInt8() -> UInt8 { _value as! UInt8 }
-        public func getInt16() -> Int16 { _value as! Int16 }
-        public func getUInt16() -> UInt16 { _value as! UInt16 }
-        public func getInt32() -> Int32 { _value as! Int32 }
-        public func getUInt32() -> UInt32 { _value as! UInt32 }
-        public func getInt64() -> Int64 { _value as! Int64 }
-        public func getUInt64() -> UInt64 { _value as! UInt64 }
-        public func getSingle() -> Float { _value as! Float }
-        public func getDouble() -> Double { _value as! Double }
+        public func getUInt8() throws -> UInt8 { try PropertyValue.number(_value) }
+        public func getInt16() throws -> Int16 { try PropertyValue.number(_value) }
+        public func getUInt16() throws -> UInt16 { try PropertyValue.number(_value) }
+        public func getInt32() throws -> Int32 { try PropertyValue.number(_value) }
+        public func getUInt32() throws -> UInt32 { try PropertyValue.number(_value) }
+        public func getInt64() throws -> Int64 { try PropertyValue.number(_value) }
+        public func getUInt64() throws -> UInt64 { try PropertyValue.number(_value) }
+        public func getSingle() throws -> Float { try PropertyValue.number(_value) }
+        public func getDouble() throws -> Double { try PropertyValue.number(_value) }
         public func getChar16() -> Character { _value as! Character }
         public func getBoolean() -> Bool { _value as! Bool }
         public func getString() -> String { _value as! String }
@@ -2341,9 +2445,7 @@ extension __ABI_Windows_Foundation {
                 var value = [WindowsFoundation.DateTime]()
                 try __unwrapped__instance.getDateTimeArray(&value)
                 $1?.initialize(to: UInt32(value.count))
-                do {
-                    try value.fill(abi: $2)
-                } catch { return failWith(error: error) }
+                value.fill(abi: $2)
                 return S_OK
             } catch { return failWith(error: error) }
         },
@@ -2354,9 +2456,7 @@ extension __ABI_Windows_Foundation {
                 var value = [WindowsFoundation.TimeSpan]()
                 try __unwrapped__instance.getTimeSpanArray(&value)
                 $1?.initialize(to: UInt32(value.count))
-                do {
-                    try value.fill(abi: $2)
-                } catch { return failWith(error: error) }
+                value.fill(abi: $2)
                 return S_OK
             } catch { return failWith(error: error) }
         },
@@ -2367,9 +2467,7 @@ extension __ABI_Windows_Foundation {
                 var value = [WindowsFoundation.Point]()
                 try __unwrapped__instance.getPointArray(&value)
                 $1?.initialize(to: UInt32(value.count))
-                do {
-                    try value.fill(abi: $2)
-                } catch { return failWith(error: error) }
+                value.fill(abi: $2)
                 return S_OK
             } catch { return failWith(error: error) }
         },
@@ -2380,9 +2478,7 @@ extension __ABI_Windows_Foundation {
                 var value = [WindowsFoundation.Size]()
                 try __unwrapped__instance.getSizeArray(&value)
                 $1?.initialize(to: UInt32(value.count))
-                do {
-                    try value.fill(abi: $2)
-                } catch { return failWith(error: error) }
+                value.fill(abi: $2)
                 return S_OK
             } catch { return failWith(error: error) }
         },
@@ -2393,9 +2489,7 @@ extension __ABI_Windows_Foundation {
                 var value = [WindowsFoundation.Rect]()
                 try __unwrapped__instance.getRectArray(&value)
                 $1?.initialize(to: UInt32(value.count))
-                do {
-                    try value.fill(abi: $2)
-                } catch { return failWith(error: error) }
+                value.fill(abi: $2)
                 return S_OK
             } catch { return failWith(error: error) }
         }
@@ -2436,12 +2530,15 @@ public protocol IStringable : WinRTInterface {
 
 extension IStringable {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Foundation.IStringableWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IStringableWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x96369F54:
+                if iid == __ABI_Windows_Foundation.IStringableWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IStringableWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIStringable = any IStringable
@@ -2561,12 +2658,15 @@ public protocol IWwwFormUrlDecoderEntry : WinRTInterface {
 
 extension IWwwFormUrlDecoderEntry {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_Windows_Foundation.IWwwFormUrlDecoderEntryWrapper.IID:
-                let wrapper = __ABI_Windows_Foundation.IWwwFormUrlDecoderEntryWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x125E7431:
+                if iid == __ABI_Windows_Foundation.IWwwFormUrlDecoderEntryWrapper.IID {
+                    let wrapper = __ABI_Windows_Foundation.IWwwFormUrlDecoderEntryWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIWwwFormUrlDecoderEntry = any IWwwFormUrlDecoderEntry
@@ -3271,9 +3371,10 @@ extension __ABI_Windows_Foundation {
 
         public func CombineUri(_ relativeUri: String) throws -> WindowsFoundation.Uri? {
             let (instance) = try ComPtrs.initialize { instanceAbi in
-                let _relativeUri = try! HString(relativeUri)
-                _ = try perform(as: __x_ABI_CWindows_CFoundation_CIUriRuntimeClass.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CombineUri(pThis, _relativeUri.get(), &instanceAbi))
+                try relativeUri.withHStringRef { _relativeUri in
+                    _ = try perform(as: __x_ABI_CWindows_CFoundation_CIUriRuntimeClass.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CombineUri(pThis, _relativeUri, &instanceAbi))
+                    }
                 }
             }
             return __IMPL_Windows_Foundation.UriBridge.from(abi: instance)
@@ -3317,9 +3418,10 @@ extension __ABI_Windows_Foundation {
 
         public func UnescapeComponent(_ toUnescape: String) throws -> String {
             var value: HSTRING?
-            let _toUnescape = try! HString(toUnescape)
-            _ = try perform(as: __x_ABI_CWindows_CFoundation_CIUriEscapeStatics.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.UnescapeComponent(pThis, _toUnescape.get(), &value))
+            try toUnescape.withHStringRef { _toUnescape in
+                _ = try perform(as: __x_ABI_CWindows_CFoundation_CIUriEscapeStatics.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.UnescapeComponent(pThis, _toUnescape, &value))
+                }
             }
             defer { WindowsDeleteString(value) }
             return .init(from: value)
@@ -3327,9 +3429,10 @@ extension __ABI_Windows_Foundation {
 
         public func EscapeComponent(_ toEscape: String) throws -> String {
             var value: HSTRING?
-            let _toEscape = try! HString(toEscape)
-            _ = try perform(as: __x_ABI_CWindows_CFoundation_CIUriEscapeStatics.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.EscapeComponent(pThis, _toEscape.get(), &value))
+            try toEscape.withHStringRef { _toEscape in
+                _ = try perform(as: __x_ABI_CWindows_CFoundation_CIUriEscapeStatics.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.EscapeComponent(pThis, _toEscape, &value))
+                }
             }
             defer { WindowsDeleteString(value) }
             return .init(from: value)
@@ -3346,9 +3449,10 @@ extension __ABI_Windows_Foundation {
 
         public func CreateUri(_ uri: String) throws -> IUriRuntimeClass {
             let (instance) = try ComPtrs.initialize { instanceAbi in
-                let _uri = try! HString(uri)
-                _ = try perform(as: __x_ABI_CWindows_CFoundation_CIUriRuntimeClassFactory.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateUri(pThis, _uri.get(), &instanceAbi))
+                try uri.withHStringRef { _uri in
+                    _ = try perform(as: __x_ABI_CWindows_CFoundation_CIUriRuntimeClassFactory.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateUri(pThis, _uri, &instanceAbi))
+                    }
                 }
             }
             return IUriRuntimeClass(instance!)
@@ -3356,10 +3460,12 @@ extension __ABI_Windows_Foundation {
 
         public func CreateWithRelativeUri(_ baseUri: String, _ relativeUri: String) throws -> IUriRuntimeClass {
             let (instance) = try ComPtrs.initialize { instanceAbi in
-                let _baseUri = try! HString(baseUri)
-                let _relativeUri = try! HString(relativeUri)
-                _ = try perform(as: __x_ABI_CWindows_CFoundation_CIUriRuntimeClassFactory.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateWithRelativeUri(pThis, _baseUri.get(), _relativeUri.get(), &instanceAbi))
+                try baseUri.withHStringRef { _baseUri in
+                    try relativeUri.withHStringRef { _relativeUri in
+                    _ = try perform(as: __x_ABI_CWindows_CFoundation_CIUriRuntimeClassFactory.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateWithRelativeUri(pThis, _baseUri, _relativeUri, &instanceAbi))
+                    }
+                }
                 }
             }
             return IUriRuntimeClass(instance!)
@@ -3418,6 +3524,9 @@ public final class WwwFormUrlDecoder : WinRTClass, IIterable, IVectorView {
         return Int(index)
     }
     public var count: Int { Int(size) }
+    public func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
     public subscript(position: Int) -> Element {
         get {
@@ -3490,9 +3599,10 @@ extension __ABI_Windows_Foundation {
 
         public func GetFirstValueByName(_ name: String) throws -> String {
             var phstrValue: HSTRING?
-            let _name = try! HString(name)
-            _ = try perform(as: __x_ABI_CWindows_CFoundation_CIWwwFormUrlDecoderRuntimeClass.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.GetFirstValueByName(pThis, _name.get(), &phstrValue))
+            try name.withHStringRef { _name in
+                _ = try perform(as: __x_ABI_CWindows_CFoundation_CIWwwFormUrlDecoderRuntimeClass.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.GetFirstValueByName(pThis, _name, &phstrValue))
+                }
             }
             defer { WindowsDeleteString(phstrValue) }
             return .init(from: phstrValue)
@@ -3509,9 +3619,10 @@ extension __ABI_Windows_Foundation {
 
         public func CreateWwwFormUrlDecoder(_ query: String) throws -> IWwwFormUrlDecoderRuntimeClass {
             let (instance) = try ComPtrs.initialize { instanceAbi in
-                let _query = try! HString(query)
-                _ = try perform(as: __x_ABI_CWindows_CFoundation_CIWwwFormUrlDecoderRuntimeClassFactory.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateWwwFormUrlDecoder(pThis, _query.get(), &instanceAbi))
+                try query.withHStringRef { _query in
+                    _ = try perform(as: __x_ABI_CWindows_CFoundation_CIWwwFormUrlDecoderRuntimeClassFactory.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateWwwFormUrlDecoder(pThis, _query, &instanceAbi))
+                    }
                 }
             }
             return IWwwFormUrlDecoderRuntimeClass(instance!)
@@ -358,11 +358,10 @@ public class IIteratorIKeyValuePairString_Any: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [WindowsFoundation.AnyIKeyValuePair<String, Any?>?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: WindowsFoundation.__x_ABI_C__FIKeyValuePair_2_HSTRING_IInspectableBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: WindowsFoundation.__x_ABI_C__FIKeyValuePair_2_HSTRING_IInspectableBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_C__FIKeyValuePair_2_HSTRING_IInspectable.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: WindowsFoundation.__x_ABI_C__FIKeyValuePair_2_HSTRING_IInspectableBridge.self, abi: _items)
         }
         return result
     }
@@ -510,11 +509,10 @@ public class IIteratorIKeyValuePairString_String: WindowsFoundation.IInspectable
 
     open func GetMany(_ items: inout [WindowsFoundation.AnyIKeyValuePair<String, String>?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: WindowsFoundation.__x_ABI_C__FIKeyValuePair_2_HSTRING_HSTRINGBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: WindowsFoundation.__x_ABI_C__FIKeyValuePair_2_HSTRING_HSTRINGBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_C__FIKeyValuePair_2_HSTRING_HSTRING.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: WindowsFoundation.__x_ABI_C__FIKeyValuePair_2_HSTRING_HSTRINGBridge.self, abi: _items)
         }
         return result
     }
@@ -662,11 +660,10 @@ public class IIteratorIWwwFormUrlDecoderEntry: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [WindowsFoundation.AnyIWwwFormUrlDecoderEntry?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_Windows_Foundation.IWwwFormUrlDecoderEntryBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_Windows_Foundation.IWwwFormUrlDecoderEntryBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_CWindows__CFoundation__CIWwwFormUrlDecoderEntry.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_Windows_Foundation.IWwwFormUrlDecoderEntryBridge.self, abi: _items)
         }
         return result
     }
@@ -1118,9 +1115,10 @@ public class IMapViewString_Any: WindowsFoundation.IInspectable {
 
     open func Lookup(_ key: String) throws -> Any? {
         let (result) = try ComPtrs.initialize { resultAbi in
-            let _key = try! HString(key)
-            _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_IInspectable.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key.get(), &resultAbi))
+            try key.withHStringRef { _key in
+                _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_IInspectable.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key, &resultAbi))
+                }
             }
         }
         return __ABI_.AnyWrapper.unwrapFrom(abi: result)
@@ -1136,9 +1134,10 @@ public class IMapViewString_Any: WindowsFoundation.IInspectable {
 
     open func HasKey(_ key: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_IInspectable.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_IInspectable.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key, &result))
+            }
         }
         return .init(from: result)
     }
@@ -1284,9 +1283,10 @@ public class IMapViewString_String: WindowsFoundation.IInspectable {
 
     open func Lookup(_ key: String) throws -> String {
         var result: HSTRING?
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key, &result))
+            }
         }
         defer { WindowsDeleteString(result) }
         return .init(from: result)
@@ -1302,9 +1302,10 @@ public class IMapViewString_String: WindowsFoundation.IInspectable {
 
     open func HasKey(_ key: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key, &result))
+            }
         }
         return .init(from: result)
     }
@@ -1469,9 +1470,10 @@ public class IMapString_Any: WindowsFoundation.IInspectable {
 
     open func Lookup(_ key: String) throws -> Any? {
         let (result) = try ComPtrs.initialize { resultAbi in
-            let _key = try! HString(key)
-            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key.get(), &resultAbi))
+            try key.withHStringRef { _key in
+                _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key, &resultAbi))
+                }
             }
         }
         return __ABI_.AnyWrapper.unwrapFrom(abi: result)
@@ -1487,9 +1489,10 @@ public class IMapString_Any: WindowsFoundation.IInspectable {
 
     open func HasKey(_ key: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key, &result))
+            }
         }
         return .init(from: result)
     }
@@ -1505,19 +1508,21 @@ public class IMapString_Any: WindowsFoundation.IInspectable {
 
     open func Insert(_ key: String, _ value: Any?) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        let valueWrapper = __ABI_.AnyWrapper(value)
-        let _value = try! valueWrapper?.toABI { $0 }
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Insert(pThis, _key.get(), _value, &result))
+        try key.withHStringRef { _key in
+            let valueWrapper = __ABI_.AnyWrapper(value)
+            let _value = try! valueWrapper?.toABI { $0 }
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Insert(pThis, _key, _value, &result))
+            }
         }
         return .init(from: result)
     }
 
     open func Remove(_ key: String) throws {
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Remove(pThis, _key.get()))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_IInspectable.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Remove(pThis, _key))
+            }
         }
     }
 
@@ -1691,9 +1696,10 @@ public class IMapString_String: WindowsFoundation.IInspectable {
 
     open func Lookup(_ key: String) throws -> String {
         var result: HSTRING?
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key, &result))
+            }
         }
         defer { WindowsDeleteString(result) }
         return .init(from: result)
@@ -1709,9 +1715,10 @@ public class IMapString_String: WindowsFoundation.IInspectable {
 
     open func HasKey(_ key: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key, &result))
+            }
         }
         return .init(from: result)
     }
@@ -1727,18 +1734,21 @@ public class IMapString_String: WindowsFoundation.IInspectable {
 
     open func Insert(_ key: String, _ value: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        let _value = try! HString(value)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Insert(pThis, _key.get(), _value.get(), &result))
+        try key.withHStringRef { _key in
+            try value.withHStringRef { _value in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Insert(pThis, _key, _value, &result))
+            }
+        }
         }
         return .init(from: result)
     }
 
     open func Remove(_ key: String) throws {
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Remove(pThis, _key.get()))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Remove(pThis, _key))
+            }
         }
     }
 
@@ -1883,6 +1893,15 @@ public class IObservableMapString_Any: WindowsFoundation.IInspectable {
         return result
     }
 
+    @_spi(WinRTInternal)
+    public func add_MapChanged(_ vhnd: UnsafeMutablePointer<__x_ABI_C__FMapChangedEventHandler_2_HSTRING_IInspectable>?) throws -> EventRegistrationToken {
+        var result: EventRegistrationToken = .init()
+        _ = try perform(as: __x_ABI_C__FIObservableMap_2_HSTRING_IInspectable.self) { pThis in
+            try CHECKED(pThis.pointee.lpVtbl.pointee.add_MapChanged(pThis, vhnd, &result))
+        }
+        return result
+    }
+
     open func remove_MapChanged(_ token: EventRegistrationToken) throws {
         _ = try perform(as: __x_ABI_C__FIObservableMap_2_HSTRING_IInspectable.self) { pThis in
             try CHECKED(pThis.pointee.lpVtbl.pointee.remove_MapChanged(pThis, token))
@@ -1920,12 +1939,13 @@ fileprivate class __x_ABI_C__FIObservableMap_2_HSTRING_IInspectableImpl : IObser
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.foundation.collections.iobservablemap-2.mapchanged)
     fileprivate lazy var mapChanged : Event<MapChangedEventHandler<String, Any?>> = {
       .init(
+        bridge: WindowsFoundation.__x_ABI_C__FMapChangedEventHandler_2_HSTRING_IInspectableBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_MapChanged($0)
+          return try this.add_MapChanged($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_MapChanged($0)
+         try self?._default.remove_MapChanged($0)
        }
       )
     }()
@@ -2038,6 +2058,15 @@ public class IObservableMapString_String: WindowsFoundation.IInspectable {
         return result
     }
 
+    @_spi(WinRTInternal)
+    public func add_MapChanged(_ vhnd: UnsafeMutablePointer<__x_ABI_C__FMapChangedEventHandler_2_HSTRING_HSTRING>?) throws -> EventRegistrationToken {
+        var result: EventRegistrationToken = .init()
+        _ = try perform(as: __x_ABI_C__FIObservableMap_2_HSTRING_HSTRING.self) { pThis in
+            try CHECKED(pThis.pointee.lpVtbl.pointee.add_MapChanged(pThis, vhnd, &result))
+        }
+        return result
+    }
+
     open func remove_MapChanged(_ token: EventRegistrationToken) throws {
         _ = try perform(as: __x_ABI_C__FIObservableMap_2_HSTRING_HSTRING.self) { pThis in
             try CHECKED(pThis.pointee.lpVtbl.pointee.remove_MapChanged(pThis, token))
@@ -2075,12 +2104,13 @@ fileprivate class __x_ABI_C__FIObservableMap_2_HSTRING_HSTRINGImpl : IObservable
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.foundation.collections.iobservablemap-2.mapchanged)
     fileprivate lazy var mapChanged : Event<MapChangedEventHandler<String, String>> = {
       .init(
+        bridge: WindowsFoundation.__x_ABI_C__FMapChangedEventHandler_2_HSTRING_HSTRINGBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_MapChanged($0)
+          return try this.add_MapChanged($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_MapChanged($0)
+         try self?._default.remove_MapChanged($0)
        }
       )
     }()
@@ -2232,11 +2262,10 @@ public class IVectorViewIWwwFormUrlDecoderEntry: WindowsFoundation.IInspectable
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [WindowsFoundation.AnyIWwwFormUrlDecoderEntry?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_Windows_Foundation.IWwwFormUrlDecoderEntryBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_Windows_Foundation.IWwwFormUrlDecoderEntryBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CFoundation__CIWwwFormUrlDecoderEntry.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_Windows_Foundation.IWwwFormUrlDecoderEntryBridge.self, abi: _items)
         }
         return result
     }
@@ -2281,6 +2310,9 @@ fileprivate class __x_ABI_C__FIVectorView_1___x_ABI_CWindows__CFoundation__CIWww
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
     subscript(position: Int) -> Element {
         get {
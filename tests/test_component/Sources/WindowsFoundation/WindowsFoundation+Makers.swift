@@ -0,0 +1,47 @@
+// WARNING: Please don't edit this file. It was generated by Swift/WinRT v0.0.1
+// swiftlint:disable all
+import Foundation
+import CWinRT
+
+@_spi(WinRTInternal)
+public final class __MakerTable: MakerTable {
+    public static let seeds: [UInt32] = [
+        1, 1, 2, 0, 0, 1, 4, 2, 2, 8, 5, 0, 0, 21, 1, 8,
+    ]
+    public static let names: [String] = [
+        "Windows.Foundation.Collections.StringMap",
+        "Windows.Foundation.IAsyncInfo",
+        "Windows.Foundation.Deferral",
+        "Windows.Foundation.WwwFormUrlDecoder",
+        "Windows.Foundation.IMemoryBuffer",
+        "Windows.Foundation.Collections.ValueSet",
+        "Windows.Foundation.IClosable",
+        "Windows.Foundation.Collections.IPropertySet",
+        "Windows.Foundation.IAsyncAction",
+        "Windows.Foundation.Collections.IVectorChangedEventArgs",
+        "Windows.Foundation.IStringable",
+        "Windows.Foundation.Uri",
+        "Windows.Foundation.Collections.PropertySet",
+        "Windows.Foundation.IMemoryBufferReference",
+        "Windows.Foundation.MemoryBuffer",
+        "Windows.Foundation.IWwwFormUrlDecoderEntry",
+    ]
+    public static let makers: [any MakeFromAbi.Type] = [
+        StringMapMaker.self,
+        IAsyncInfoMaker.self,
+        DeferralMaker.self,
+        WwwFormUrlDecoderMaker.self,
+        IMemoryBufferMaker.self,
+        ValueSetMaker.self,
+        IClosableMaker.self,
+        IPropertySetMaker.self,
+        IAsyncActionMaker.self,
+        IVectorChangedEventArgsMaker.self,
+        IStringableMaker.self,
+        UriMaker.self,
+        PropertySetMaker.self,
+        IMemoryBufferReferenceMaker.self,
+        MemoryBufferMaker.self,
+        IWwwFormUrlDecoderEntryMaker.self,
+    ]
+}
@@ -0,0 +1,18 @@
+// WARNING: Please don't edit this file. It was generated by Swift/WinRT v0.0.1
+// swiftlint:disable all
+import Foundation
+@_spi(WinRTInternal) @_spi(WinRTImplements) import WindowsFoundation
+import CWinRT
+
+@_spi(WinRTInternal)
+public final class __MakerTable: MakerTable {
+    public static let seeds: [UInt32] = [
+        1,
+    ]
+    public static let names: [String] = [
+        "external_base.ExternalBase",
+    ]
+    public static let makers: [any MakeFromAbi.Type] = [
+        ExternalBaseMaker.self,
+    ]
+}
@@ -867,11 +867,10 @@ public class IIteratorAny: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [Any?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_.AnyBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_.AnyBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1_IInspectable.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_.AnyBridge.self, abi: _items)
         }
         return result
     }
@@ -1172,11 +1171,10 @@ public class IIteratorString: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [String]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI { _items in
+        try items.fillFromAbi { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1_HSTRING.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abi: _items)
         }
         return result
     }
@@ -1324,11 +1322,10 @@ public class IIteratorIKeyValuePairString_String: WindowsFoundation.IInspectable
 
     open func GetMany(_ items: inout [WindowsFoundation.AnyIKeyValuePair<String, String>?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: test_component.__x_ABI_C__FIKeyValuePair_2_HSTRING_HSTRINGBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: test_component.__x_ABI_C__FIKeyValuePair_2_HSTRING_HSTRINGBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_C__FIKeyValuePair_2_HSTRING_HSTRING.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: test_component.__x_ABI_C__FIKeyValuePair_2_HSTRING_HSTRINGBridge.self, abi: _items)
         }
         return result
     }
@@ -1476,11 +1473,10 @@ public class IIteratorIKeyValuePairString_Base: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [WindowsFoundation.AnyIKeyValuePair<String, test_component.Base?>?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: test_component.__x_ABI_C__FIKeyValuePair_2_HSTRING___x_ABI_Ctest__zcomponent__CBaseBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: test_component.__x_ABI_C__FIKeyValuePair_2_HSTRING___x_ABI_Ctest__zcomponent__CBaseBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_C__FIKeyValuePair_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: test_component.__x_ABI_C__FIKeyValuePair_2_HSTRING___x_ABI_Ctest__zcomponent__CBaseBridge.self, abi: _items)
         }
         return result
     }
@@ -1627,11 +1623,10 @@ public class IIteratorBase: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [test_component.Base?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_test_component.BaseBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_test_component.BaseBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_test_component.BaseBridge.self, abi: _items)
         }
         return result
     }
@@ -1779,11 +1774,10 @@ public class IIteratorIBasic: WindowsFoundation.IInspectable {
 
     open func GetMany(_ items: inout [test_component.AnyIBasic?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_test_component.IBasicBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_test_component.IBasicBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIIterator_1___x_ABI_Ctest__zcomponent__CIBasic.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_test_component.IBasicBridge.self, abi: _items)
         }
         return result
     }
@@ -2127,9 +2121,10 @@ public class IMapViewString_String: WindowsFoundation.IInspectable {
 
     open func Lookup(_ key: String) throws -> String {
         var result: HSTRING?
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key, &result))
+            }
         }
         defer { WindowsDeleteString(result) }
         return .init(from: result)
@@ -2145,9 +2140,10 @@ public class IMapViewString_String: WindowsFoundation.IInspectable {
 
     open func HasKey(_ key: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key, &result))
+            }
         }
         return .init(from: result)
     }
@@ -2293,9 +2289,10 @@ public class IMapViewString_Base: WindowsFoundation.IInspectable {
 
     open func Lookup(_ key: String) throws -> test_component.Base? {
         let (result) = try ComPtrs.initialize { resultAbi in
-            let _key = try! HString(key)
-            _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key.get(), &resultAbi))
+            try key.withHStringRef { _key in
+                _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key, &resultAbi))
+                }
             }
         }
         return __IMPL_test_component.BaseBridge.from(abi: result)
@@ -2311,9 +2308,10 @@ public class IMapViewString_Base: WindowsFoundation.IInspectable {
 
     open func HasKey(_ key: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMapView_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key, &result))
+            }
         }
         return .init(from: result)
     }
@@ -2477,9 +2475,10 @@ public class IMapString_String: WindowsFoundation.IInspectable {
 
     open func Lookup(_ key: String) throws -> String {
         var result: HSTRING?
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key, &result))
+            }
         }
         defer { WindowsDeleteString(result) }
         return .init(from: result)
@@ -2495,9 +2494,10 @@ public class IMapString_String: WindowsFoundation.IInspectable {
 
     open func HasKey(_ key: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key, &result))
+            }
         }
         return .init(from: result)
     }
@@ -2513,18 +2513,21 @@ public class IMapString_String: WindowsFoundation.IInspectable {
 
     open func Insert(_ key: String, _ value: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        let _value = try! HString(value)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Insert(pThis, _key.get(), _value.get(), &result))
+        try key.withHStringRef { _key in
+            try value.withHStringRef { _value in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Insert(pThis, _key, _value, &result))
+            }
+        }
         }
         return .init(from: result)
     }
 
     open func Remove(_ key: String) throws {
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Remove(pThis, _key.get()))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Remove(pThis, _key))
+            }
         }
     }
 
@@ -2698,9 +2701,10 @@ public class IMapString_Base: WindowsFoundation.IInspectable {
 
     open func Lookup(_ key: String) throws -> test_component.Base? {
         let (result) = try ComPtrs.initialize { resultAbi in
-            let _key = try! HString(key)
-            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key.get(), &resultAbi))
+            try key.withHStringRef { _key in
+                _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.Lookup(pThis, _key, &resultAbi))
+                }
             }
         }
         return __IMPL_test_component.BaseBridge.from(abi: result)
@@ -2716,9 +2720,10 @@ public class IMapString_Base: WindowsFoundation.IInspectable {
 
     open func HasKey(_ key: String) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key.get(), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.HasKey(pThis, _key, &result))
+            }
         }
         return .init(from: result)
     }
@@ -2734,17 +2739,19 @@ public class IMapString_Base: WindowsFoundation.IInspectable {
 
     open func Insert(_ key: String, _ value: test_component.Base?) throws -> Bool {
         var result: boolean = 0
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Insert(pThis, _key.get(), RawPointer(value), &result))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Insert(pThis, _key, RawPointer(value), &result))
+            }
         }
         return .init(from: result)
     }
 
     open func Remove(_ key: String) throws {
-        let _key = try! HString(key)
-        _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Remove(pThis, _key.get()))
+        try key.withHStringRef { _key in
+            _ = try perform(as: __x_ABI_C__FIMap_2_HSTRING___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Remove(pThis, _key))
+            }
         }
     }
 
@@ -2889,6 +2896,15 @@ public class IObservableVectorBase: WindowsFoundation.IInspectable {
         return result
     }
 
+    @_spi(WinRTInternal)
+    public func add_VectorChanged(_ vhnd: UnsafeMutablePointer<__x_ABI_C__FVectorChangedEventHandler_1___x_ABI_Ctest__zcomponent__CBase>?) throws -> EventRegistrationToken {
+        var result: EventRegistrationToken = .init()
+        _ = try perform(as: __x_ABI_C__FIObservableVector_1___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
+            try CHECKED(pThis.pointee.lpVtbl.pointee.add_VectorChanged(pThis, vhnd, &result))
+        }
+        return result
+    }
+
     open func remove_VectorChanged(_ token: EventRegistrationToken) throws {
         _ = try perform(as: __x_ABI_C__FIObservableVector_1___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
             try CHECKED(pThis.pointee.lpVtbl.pointee.remove_VectorChanged(pThis, token))
@@ -2935,6 +2951,9 @@ fileprivate class __x_ABI_C__FIObservableVector_1___x_ABI_Ctest__zcomponent__CBa
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
 
     subscript(position: Int) -> Element {
@@ -2954,12 +2973,13 @@ fileprivate class __x_ABI_C__FIObservableVector_1___x_ABI_Ctest__zcomponent__CBa
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.foundation.collections.iobservablevector-1.vectorchanged)
     fileprivate lazy var vectorChanged : Event<VectorChangedEventHandler<Base?>> = {
       .init(
+        bridge: test_component.__x_ABI_C__FVectorChangedEventHandler_1___x_ABI_Ctest__zcomponent__CBaseBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_VectorChanged($0)
+          return try this.add_VectorChanged($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_VectorChanged($0)
+         try self?._default.remove_VectorChanged($0)
        }
       )
     }()
@@ -3097,6 +3117,15 @@ public class IObservableVectorIBasic: WindowsFoundation.IInspectable {
         return result
     }
 
+    @_spi(WinRTInternal)
+    public func add_VectorChanged(_ vhnd: UnsafeMutablePointer<__x_ABI_C__FVectorChangedEventHandler_1___x_ABI_Ctest__zcomponent__CIBasic>?) throws -> EventRegistrationToken {
+        var result: EventRegistrationToken = .init()
+        _ = try perform(as: __x_ABI_C__FIObservableVector_1___x_ABI_Ctest__zcomponent__CIBasic.self) { pThis in
+            try CHECKED(pThis.pointee.lpVtbl.pointee.add_VectorChanged(pThis, vhnd, &result))
+        }
+        return result
+    }
+
     open func remove_VectorChanged(_ token: EventRegistrationToken) throws {
         _ = try perform(as: __x_ABI_C__FIObservableVector_1___x_ABI_Ctest__zcomponent__CIBasic.self) { pThis in
             try CHECKED(pThis.pointee.lpVtbl.pointee.remove_VectorChanged(pThis, token))
@@ -3143,6 +3172,9 @@ fileprivate class __x_ABI_C__FIObservableVector_1___x_ABI_Ctest__zcomponent__CIB
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
 
     subscript(position: Int) -> Element {
@@ -3162,12 +3194,13 @@ fileprivate class __x_ABI_C__FIObservableVector_1___x_ABI_Ctest__zcomponent__CIB
     /// [Open Microsoft documentation](https://learn.microsoft.com/uwp/api/windows.foundation.collections.iobservablevector-1.vectorchanged)
     fileprivate lazy var vectorChanged : Event<VectorChangedEventHandler<IBasic?>> = {
       .init(
+        bridge: test_component.__x_ABI_C__FVectorChangedEventHandler_1___x_ABI_Ctest__zcomponent__CIBasicBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_VectorChanged($0)
+          return try this.add_VectorChanged($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_VectorChanged($0)
+         try self?._default.remove_VectorChanged($0)
        }
       )
     }()
@@ -3344,11 +3377,10 @@ public class IVectorViewAny: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [Any?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_.AnyBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_.AnyBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIVectorView_1_IInspectable.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_.AnyBridge.self, abi: _items)
         }
         return result
     }
@@ -3393,6 +3425,9 @@ fileprivate class __x_ABI_C__FIVectorView_1_IInspectableImpl : IVectorView, AbiI
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
     subscript(position: Int) -> Element {
         get {
@@ -3707,20 +3742,20 @@ public class IVectorViewString: WindowsFoundation.IInspectable {
 
     open func IndexOf(_ value: String, _ index: inout UInt32) throws -> Bool {
         var result: boolean = 0
-        let _value = try! HString(value)
-        _ = try perform(as: __x_ABI_C__FIVectorView_1_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.IndexOf(pThis, _value.get(), &index, &result))
+        try value.withHStringRef { _value in
+            _ = try perform(as: __x_ABI_C__FIVectorView_1_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.IndexOf(pThis, _value, &index, &result))
+            }
         }
         return .init(from: result)
     }
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [String]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI { _items in
+        try items.fillFromAbi { _items in
             _ = try perform(as: __x_ABI_C__FIVectorView_1_HSTRING.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abi: _items)
         }
         return result
     }
@@ -3765,6 +3800,9 @@ fileprivate class __x_ABI_C__FIVectorView_1_HSTRINGImpl : IVectorView, AbiInterf
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: "")
+    }
 
     subscript(position: Int) -> Element {
         get {
@@ -3900,11 +3938,10 @@ public class IVectorViewBase: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [test_component.Base?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_test_component.BaseBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_test_component.BaseBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIVectorView_1___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_test_component.BaseBridge.self, abi: _items)
         }
         return result
     }
@@ -3949,6 +3986,9 @@ fileprivate class __x_ABI_C__FIVectorView_1___x_ABI_Ctest__zcomponent__CBaseImpl
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
     subscript(position: Int) -> Element {
         get {
@@ -4087,11 +4127,10 @@ public class IVectorViewIBasic: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [test_component.AnyIBasic?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_test_component.IBasicBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_test_component.IBasicBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIVectorView_1___x_ABI_Ctest__zcomponent__CIBasic.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_test_component.IBasicBridge.self, abi: _items)
         }
         return result
     }
@@ -4136,6 +4175,9 @@ fileprivate class __x_ABI_C__FIVectorView_1___x_ABI_Ctest__zcomponent__CIBasicIm
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
     subscript(position: Int) -> Element {
         get {
@@ -4382,11 +4424,10 @@ public class IVectorAny: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [Any?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_.AnyBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_.AnyBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIVector_1_IInspectable.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_.AnyBridge.self, abi: _items)
         }
         return result
     }
@@ -4439,6 +4480,9 @@ fileprivate class __x_ABI_C__FIVector_1_IInspectableImpl : IVector, AbiInterface
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
 
     subscript(position: Int) -> Element {
@@ -5027,24 +5071,27 @@ public class IVectorString: WindowsFoundation.IInspectable {
 
     open func IndexOf(_ value: String, _ index: inout UInt32) throws -> Bool {
         var result: boolean = 0
-        let _value = try! HString(value)
-        _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.IndexOf(pThis, _value.get(), &index, &result))
+        try value.withHStringRef { _value in
+            _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.IndexOf(pThis, _value, &index, &result))
+            }
         }
         return .init(from: result)
     }
 
     open func SetAt(_ index: UInt32, _ value: String) throws {
-        let _value = try! HString(value)
-        _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.SetAt(pThis, index, _value.get()))
+        try value.withHStringRef { _value in
+            _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.SetAt(pThis, index, _value))
+            }
         }
     }
 
     open func InsertAt(_ index: UInt32, _ value: String) throws {
-        let _value = try! HString(value)
-        _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.InsertAt(pThis, index, _value.get()))
+        try value.withHStringRef { _value in
+            _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.InsertAt(pThis, index, _value))
+            }
         }
     }
 
@@ -5055,9 +5102,10 @@ public class IVectorString: WindowsFoundation.IInspectable {
     }
 
     open func Append(_ value: String) throws {
-        let _value = try! HString(value)
-        _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
-            try CHECKED(pThis.pointee.lpVtbl.pointee.Append(pThis, _value.get()))
+        try value.withHStringRef { _value in
+            _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.Append(pThis, _value))
+            }
         }
     }
 
@@ -5075,11 +5123,10 @@ public class IVectorString: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [String]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI { _items in
+        try items.fillFromAbi { _items in
             _ = try perform(as: __x_ABI_C__FIVector_1_HSTRING.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abi: _items)
         }
         return result
     }
@@ -5132,6 +5179,9 @@ fileprivate class __x_ABI_C__FIVector_1_HSTRINGImpl : IVector, AbiInterfaceImpl
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: "")
+    }
 
 
     subscript(position: Int) -> Element {
@@ -5418,11 +5468,10 @@ public class IVectorBase: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [test_component.Base?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_test_component.BaseBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_test_component.BaseBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIVector_1___x_ABI_Ctest__zcomponent__CBase.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_test_component.BaseBridge.self, abi: _items)
         }
         return result
     }
@@ -5475,6 +5524,9 @@ fileprivate class __x_ABI_C__FIVector_1___x_ABI_Ctest__zcomponent__CBaseImpl : I
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
 
     subscript(position: Int) -> Element {
@@ -5770,11 +5822,10 @@ public class IVectorIBasic: WindowsFoundation.IInspectable {
 
     open func GetMany(_ startIndex: UInt32, _ items: inout [test_component.AnyIBasic?]) throws -> UInt32 {
         var result: UINT32 = 0
-        try items.toABI(abiBridge: __IMPL_test_component.IBasicBridge.self) { _items in
+        try items.fillFromAbi(abiBridge: __IMPL_test_component.IBasicBridge.self) { _items in
             _ = try perform(as: __x_ABI_C__FIVector_1___x_ABI_Ctest__zcomponent__CIBasic.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.GetMany(pThis, startIndex, _items.count, _items.start, &result))
             }
-        items = .from(abiBridge: __IMPL_test_component.IBasicBridge.self, abi: _items)
         }
         return result
     }
@@ -5827,6 +5878,9 @@ fileprivate class __x_ABI_C__FIVector_1___x_ABI_Ctest__zcomponent__CIBasicImpl :
         return Int(index)
     }
     var count: Int { Int(size) }
+    func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
 
     subscript(position: Int) -> Element {
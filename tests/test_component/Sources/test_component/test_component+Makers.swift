@@ -0,0 +1,82 @@
+// WARNING: Please don't edit this file. It was generated by Swift/WinRT v0.0.1
+// swiftlint:disable all
+import Foundation
+@_spi(WinRTInternal) @_spi(WinRTImplements) import Foundation
+@_spi(WinRTInternal) @_spi(WinRTImplements) import WindowsFoundation
+import CWinRT
+
+@_spi(WinRTInternal)
+public final class __MakerTable: MakerTable {
+    public static let seeds: [UInt32] = [
+        3, 0, 0, 1, 2, 2, 1, 0, 0, 5, 2, 0, 10, 0, 0, 6,
+        4, 0, 2, 0, 1, 13, 9, 12, 0, 9, 0, 16, 1, 0, 17, 0,
+    ]
+    public static let names: [String] = [
+        "test_component.WithIterableGuids",
+        "test_component.NoopClosable",
+        "test_component.BaseMapCollection",
+        "test_component.IArrayShouldBuild",
+        "test_component.IAsyncMethodsWithProgress",
+        "test_component.UnsealedDerived2",
+        "test_component.IBasic",
+        "test_component.ISimpleDelegate",
+        "test_component.UnsealedDerivedNoOverrides",
+        "test_component.IAsyncOperationInt",
+        "test_component.AsyncOperationInt",
+        "test_component.WeakReferencer",
+        "test_component.Derived",
+        "test_component.IInterfaceWithObservableVector",
+        "test_component.EventTester",
+        "test_component.IArrayScenarios",
+        "test_component.Class",
+        "test_component.Simple",
+        "test_component.BaseObservableCollection",
+        "test_component.CollectionTester",
+        "test_component.IReferenceTarget",
+        "test_component.Base",
+        "test_component.IIAmImplementable",
+        "test_component.DerivedFromExternalBase",
+        "test_component.UnsealedDerivedNoConstructor",
+        "test_component.BaseCollection",
+        "test_component.UnsealedDerived",
+        "test_component.DeferrableEventArgs",
+        "test_component.WithKeyword",
+        "test_component.DerivedFromNoConstructor",
+        "test_component.UnsealedDerivedFromNoConstructor",
+        "test_component.BaseNoOverrides",
+    ]
+    public static let makers: [any MakeFromAbi.Type] = [
+        WithIterableGuidsMaker.self,
+        NoopClosableMaker.self,
+        BaseMapCollectionMaker.self,
+        IArrayShouldBuildMaker.self,
+        IAsyncMethodsWithProgressMaker.self,
+        UnsealedDerived2Maker.self,
+        IBasicMaker.self,
+        ISimpleDelegateMaker.self,
+        UnsealedDerivedNoOverridesMaker.self,
+        IAsyncOperationIntMaker.self,
+        AsyncOperationIntMaker.self,
+        WeakReferencerMaker.self,
+        DerivedMaker.self,
+        IInterfaceWithObservableVectorMaker.self,
+        EventTesterMaker.self,
+        IArrayScenariosMaker.self,
+        ClassMaker.self,
+        SimpleMaker.self,
+        BaseObservableCollectionMaker.self,
+        CollectionTesterMaker.self,
+        IReferenceTargetMaker.self,
+        BaseMaker.self,
+        IIAmImplementableMaker.self,
+        DerivedFromExternalBaseMaker.self,
+        UnsealedDerivedNoConstructorMaker.self,
+        BaseCollectionMaker.self,
+        UnsealedDerivedMaker.self,
+        DeferrableEventArgsMaker.self,
+        WithKeywordMaker.self,
+        DerivedFromNoConstructorMaker.self,
+        UnsealedDerivedFromNoConstructorMaker.self,
+        BaseNoOverridesMaker.self,
+    ]
+}
@@ -37,9 +37,10 @@ extension __ABI_test_component_Delegates {
         override public class var IID: WindowsFoundation.IID { IID___x_ABI_Ctest__component_CDelegates_CIInDelegate }
 
         open func Invoke(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_Ctest__component_CDelegates_CIInDelegate.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.Invoke(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_Ctest__component_CDelegates_CIInDelegate.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.Invoke(pThis, _value))
+                }
             }
         }
 
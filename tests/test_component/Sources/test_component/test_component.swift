@@ -238,16 +238,31 @@ public struct BlittableStruct: Hashable, Codable, Sendable {
 extension BlittableStruct: WinRTBridgeable {
     public typealias ABI = __x_ABI_Ctest__component_CBlittableStruct
     public static func from(abi: ABI) -> Self {
-        .init(first: abi.First, second: abi.Second)
+        guard hasAbiLayout else {
+            return .init(first: abi.First, second: abi.Second)
+        }
+        return copy(fromABI: abi)
     }
     public func toABI() -> ABI {
         .from(swift: self)
     }
 }
 
+@_spi(WinRTInternal)
+extension BlittableStruct: WinRTBlittableStruct {
+    public static var hasAbiLayout: Bool {
+        MemoryLayout<Self>.stride == MemoryLayout<ABI>.stride &&
+            MemoryLayout<Self>.offset(of: \.first) == MemoryLayout<ABI>.offset(of: \.First) &&
+            MemoryLayout<Self>.offset(of: \.second) == MemoryLayout<ABI>.offset(of: \.Second)
+    }
+}
+
 extension __x_ABI_Ctest__component_CBlittableStruct {
     public static func from(swift: test_component.BlittableStruct) -> __x_ABI_Ctest__component_CBlittableStruct {
-        .init(First: swift.first, Second: swift.second)
+        guard test_component.BlittableStruct.hasAbiLayout else {
+            return .init(First: swift.first, Second: swift.second)
+        }
+        return swift.copyToABI()
     }
 }
 // MARK: - NonBlittableBoolStruct
@@ -372,16 +387,30 @@ public struct SimpleEventArgs: Hashable, Codable, Sendable {
 extension SimpleEventArgs: WinRTBridgeable {
     public typealias ABI = __x_ABI_Ctest__component_CSimpleEventArgs
     public static func from(abi: ABI) -> Self {
-        .init(value: abi.Value)
+        guard hasAbiLayout else {
+            return .init(value: abi.Value)
+        }
+        return copy(fromABI: abi)
     }
     public func toABI() -> ABI {
         .from(swift: self)
     }
 }
 
+@_spi(WinRTInternal)
+extension SimpleEventArgs: WinRTBlittableStruct {
+    public static var hasAbiLayout: Bool {
+        MemoryLayout<Self>.stride == MemoryLayout<ABI>.stride &&
+            MemoryLayout<Self>.offset(of: \.value) == MemoryLayout<ABI>.offset(of: \.Value)
+    }
+}
+
 extension __x_ABI_Ctest__component_CSimpleEventArgs {
     public static func from(swift: test_component.SimpleEventArgs) -> __x_ABI_Ctest__component_CSimpleEventArgs {
-        .init(Value: swift.value)
+        guard test_component.SimpleEventArgs.hasAbiLayout else {
+            return .init(Value: swift.value)
+        }
+        return swift.copyToABI()
     }
 }
 // MARK: - StructWithEnum
@@ -400,16 +429,30 @@ public struct StructWithEnum: Hashable, Codable, Sendable {
 extension StructWithEnum: WinRTBridgeable {
     public typealias ABI = __x_ABI_Ctest__component_CStructWithEnum
     public static func from(abi: ABI) -> Self {
-        .init(names: abi.Names)
+        guard hasAbiLayout else {
+            return .init(names: abi.Names)
+        }
+        return copy(fromABI: abi)
     }
     public func toABI() -> ABI {
         .from(swift: self)
     }
 }
 
+@_spi(WinRTInternal)
+extension StructWithEnum: WinRTBlittableStruct {
+    public static var hasAbiLayout: Bool {
+        MemoryLayout<Self>.stride == MemoryLayout<ABI>.stride &&
+            MemoryLayout<Self>.offset(of: \.names) == MemoryLayout<ABI>.offset(of: \.Names)
+    }
+}
+
 extension __x_ABI_Ctest__component_CStructWithEnum {
     public static func from(swift: test_component.StructWithEnum) -> __x_ABI_Ctest__component_CStructWithEnum {
-        .init(Names: swift.names)
+        guard test_component.StructWithEnum.hasAbiLayout else {
+            return .init(Names: swift.names)
+        }
+        return swift.copyToABI()
     }
 }
 // MARK: - StructWithIReference
@@ -671,12 +714,15 @@ public protocol IArrayScenarios : WinRTInterface {
 
 extension IArrayScenarios {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.IArrayScenariosWrapper.IID:
-                let wrapper = __ABI_test_component.IArrayScenariosWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x56558D36:
+                if iid == __ABI_test_component.IArrayScenariosWrapper.IID {
+                    let wrapper = __ABI_test_component.IArrayScenariosWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIArrayScenarios = any IArrayScenarios
@@ -1029,12 +1075,15 @@ public protocol IArrayShouldBuild : WinRTInterface {
 
 extension IArrayShouldBuild {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.IArrayShouldBuildWrapper.IID:
-                let wrapper = __ABI_test_component.IArrayShouldBuildWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0xA0DB5CFD:
+                if iid == __ABI_test_component.IArrayShouldBuildWrapper.IID {
+                    let wrapper = __ABI_test_component.IArrayShouldBuildWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIArrayShouldBuild = any IArrayShouldBuild
@@ -1149,12 +1198,15 @@ public protocol IAsyncMethodsWithProgress : WinRTInterface {
 
 extension IAsyncMethodsWithProgress {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.IAsyncMethodsWithProgressWrapper.IID:
-                let wrapper = __ABI_test_component.IAsyncMethodsWithProgressWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0xD782777A:
+                if iid == __ABI_test_component.IAsyncMethodsWithProgressWrapper.IID {
+                    let wrapper = __ABI_test_component.IAsyncMethodsWithProgressWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIAsyncMethodsWithProgress = any IAsyncMethodsWithProgress
@@ -1272,12 +1324,15 @@ public protocol IAsyncOperationInt : WinRTInterface {
 
 extension IAsyncOperationInt {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.IAsyncOperationIntWrapper.IID:
-                let wrapper = __ABI_test_component.IAsyncOperationIntWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x1D730A19:
+                if iid == __ABI_test_component.IAsyncOperationIntWrapper.IID {
+                    let wrapper = __ABI_test_component.IAsyncOperationIntWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIAsyncOperationInt = any IAsyncOperationInt
@@ -1408,12 +1463,15 @@ public protocol IBasic : WinRTInterface {
 
 extension IBasic {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.IBasicWrapper.IID:
-                let wrapper = __ABI_test_component.IBasicWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x636060A1:
+                if iid == __ABI_test_component.IBasicWrapper.IID {
+                    let wrapper = __ABI_test_component.IBasicWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIBasic = any IBasic
@@ -1547,12 +1605,15 @@ public extension EventSource where Handler == test_component.InDelegate {
 
 extension IIAmImplementable {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.IIAmImplementableWrapper.IID:
-                let wrapper = __ABI_test_component.IIAmImplementableWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x8FC8D4FE:
+                if iid == __ABI_test_component.IIAmImplementableWrapper.IID {
+                    let wrapper = __ABI_test_component.IIAmImplementableWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIIAmImplementable = any IIAmImplementable
@@ -1656,12 +1717,13 @@ extension __IMPL_test_component {
 
         fileprivate lazy var implementableEvent : Event<test_component.InDelegate> = {
           .init(
+            bridge: __IMPL_test_component_Delegates.InDelegateBridge.self,
             add: { [weak self] in
               guard let this = self?._default else { return .init() }
-              return try! this.add_ImplementableEvent($0)
+              return try this.add_ImplementableEvent($0)
             },
             remove: { [weak self] in
-             try? self?._default.remove_ImplementableEvent($0)
+             try self?._default.remove_ImplementableEvent($0)
            }
           )
         }()
@@ -1689,9 +1751,10 @@ extension __ABI_test_component {
 
         open func InString(_ value: String) throws -> String {
             var result: HSTRING?
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_Ctest__component_CIIAmImplementable.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.InString(pThis, _value.get(), &result))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_Ctest__component_CIIAmImplementable.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.InString(pThis, _value, &result))
+                }
             }
             defer { WindowsDeleteString(result) }
             return .init(from: result)
@@ -1840,6 +1903,15 @@ extension __ABI_test_component {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_ImplementableEvent(_ handler: UnsafeMutablePointer<__x_ABI_Ctest__component_CDelegates_CIInDelegate>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_Ctest__component_CIIAmImplementable.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_ImplementableEvent(pThis, handler, &token))
+            }
+            return token
+        }
+
         open func remove_ImplementableEvent(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_Ctest__component_CIIAmImplementable.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_ImplementableEvent(pThis, token))
@@ -1847,9 +1919,10 @@ extension __ABI_test_component {
         }
 
         open func FireEvent(_ data: String) throws {
-            let _data = try! HString(data)
-            _ = try perform(as: __x_ABI_Ctest__component_CIIAmImplementable.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.FireEvent(pThis, _data.get()))
+            try data.withHStringRef { _data in
+                _ = try perform(as: __x_ABI_Ctest__component_CIIAmImplementable.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.FireEvent(pThis, _data))
+                }
             }
         }
 
@@ -2096,12 +2169,15 @@ public protocol IInterfaceWithObservableVector : WinRTInterface {
 
 extension IInterfaceWithObservableVector {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.IInterfaceWithObservableVectorWrapper.IID:
-                let wrapper = __ABI_test_component.IInterfaceWithObservableVectorWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x364C232A:
+                if iid == __ABI_test_component.IInterfaceWithObservableVectorWrapper.IID {
+                    let wrapper = __ABI_test_component.IInterfaceWithObservableVectorWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIInterfaceWithObservableVector = any IInterfaceWithObservableVector
@@ -2215,12 +2291,15 @@ public protocol IReferenceTarget : WinRTInterface {
 
 extension IReferenceTarget {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.IReferenceTargetWrapper.IID:
-                let wrapper = __ABI_test_component.IReferenceTargetWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x128E6AAA:
+                if iid == __ABI_test_component.IReferenceTargetWrapper.IID {
+                    let wrapper = __ABI_test_component.IReferenceTargetWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyIReferenceTarget = any IReferenceTarget
@@ -2332,12 +2411,15 @@ public protocol ISimpleDelegate : WinRTInterface {
 
 extension ISimpleDelegate {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.ISimpleDelegateWrapper.IID:
-                let wrapper = __ABI_test_component.ISimpleDelegateWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0xB73AD784:
+                if iid == __ABI_test_component.ISimpleDelegateWrapper.IID {
+                    let wrapper = __ABI_test_component.ISimpleDelegateWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyISimpleDelegate = any ISimpleDelegate
@@ -2467,12 +2549,15 @@ public protocol WithIterableGuids : WinRTInterface {
 
 extension WithIterableGuids {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.WithIterableGuidsWrapper.IID:
-                let wrapper = __ABI_test_component.WithIterableGuidsWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0xF8BD03F6:
+                if iid == __ABI_test_component.WithIterableGuidsWrapper.IID {
+                    let wrapper = __ABI_test_component.WithIterableGuidsWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyWithIterableGuids = any WithIterableGuids
@@ -2591,12 +2676,15 @@ public protocol WithKeyword : WinRTInterface {
 
 extension WithKeyword {
     public func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.WithKeywordWrapper.IID:
-                let wrapper = __ABI_test_component.WithKeywordWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return nil
+        switch iid.Data1 {
+            case 0x18D4C535:
+                if iid == __ABI_test_component.WithKeywordWrapper.IID {
+                    let wrapper = __ABI_test_component.WithKeywordWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return nil
     }
 }
 public typealias AnyWithKeyword = any WithKeyword
@@ -2666,9 +2754,10 @@ extension __ABI_test_component {
         override public class var IID: WindowsFoundation.IID { IID___x_ABI_Ctest__component_CWithKeyword }
 
         open func Enum(_ `extension`: String) throws {
-            let _extension = try! HString(`extension`)
-            _ = try perform(as: __x_ABI_Ctest__component_CWithKeyword.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.Enum(pThis, _extension.get()))
+            try `extension`.withHStringRef { _extension in
+                _ = try perform(as: __x_ABI_Ctest__component_CWithKeyword.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.Enum(pThis, _extension))
+                }
             }
         }
 
@@ -2682,9 +2771,10 @@ extension __ABI_test_component {
         }
 
         open func put_Struct(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_Ctest__component_CWithKeyword.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_Struct(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_Ctest__component_CWithKeyword.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_Struct(pThis, _value))
+                }
             }
         }
 
@@ -2698,6 +2788,15 @@ extension __ABI_test_component {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_Repeat(_ handler: UnsafeMutablePointer<__x_ABI_C__FIEventHandler_1_IInspectable>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_Ctest__component_CWithKeyword.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_Repeat(pThis, handler, &token))
+            }
+            return token
+        }
+
         open func remove_Repeat(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_Ctest__component_CWithKeyword.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_Repeat(pThis, token))
@@ -3091,29 +3190,26 @@ extension __ABI_test_component {
         }
 
         public func RefStringArray(_ value: inout [String]) throws {
-            try value.toABI { _value in
+            try value.fillFromAbi { _value in
                 _ = try perform(as: __x_ABI_Ctest__component_CIArrayMethodsStatics.self) { pThis in
                     try CHECKED(pThis.pointee.lpVtbl.pointee.RefStringArray(pThis, _value.count, _value.start))
                 }
-            value = .from(abi: _value)
             }
         }
 
         public func RefObjectArray(_ value: inout [Any?]) throws {
-            try value.toABI(abiBridge: __IMPL_.AnyBridge.self) { _value in
+            try value.fillFromAbi(abiBridge: __IMPL_.AnyBridge.self) { _value in
                 _ = try perform(as: __x_ABI_Ctest__component_CIArrayMethodsStatics.self) { pThis in
                     try CHECKED(pThis.pointee.lpVtbl.pointee.RefObjectArray(pThis, _value.count, _value.start))
                 }
-            value = .from(abiBridge: __IMPL_.AnyBridge.self, abi: _value)
             }
         }
 
         public func RefStringableArray(_ value: inout [WindowsFoundation.AnyIStringable?]) throws {
-            try value.toABI(abiBridge: __IMPL_Windows_Foundation.IStringableBridge.self) { _value in
+            try value.fillFromAbi(abiBridge: __IMPL_Windows_Foundation.IStringableBridge.self) { _value in
                 _ = try perform(as: __x_ABI_Ctest__component_CIArrayMethodsStatics.self) { pThis in
                     try CHECKED(pThis.pointee.lpVtbl.pointee.RefStringableArray(pThis, _value.count, _value.start))
                 }
-            value = .from(abiBridge: __IMPL_Windows_Foundation.IStringableBridge.self, abi: _value)
             }
         }
 
@@ -3438,12 +3534,15 @@ open class Base : WinRTClass {
         MakeComposed(composing: composing, (self as! Composable.Class), createCallback)
     }
     override open func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.IBaseOverridesWrapper.IID:
-                let wrapper = __ABI_test_component.IBaseOverridesWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return super.queryInterface(iid)
+        switch iid.Data1 {
+            case 0xEE3CBD78:
+                if iid == __ABI_test_component.IBaseOverridesWrapper.IID {
+                    let wrapper = __ABI_test_component.IBaseOverridesWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return super.queryInterface(iid)
     }
     private static var _IBaseProtectedFactory : __ABI_test_component.IBaseProtectedFactory =  try! RoGetActivationFactory("test_component.Base")
 
@@ -3512,8 +3611,8 @@ extension __ABI_test_component {
     internal typealias IBaseOverridesWrapper = UnsealedWinRTClassWrapper<__IMPL_test_component.BaseBridge.IBaseOverrides>
     internal static var IBaseOverridesVTable: __x_ABI_Ctest__component_CIBaseOverridesVtbl = .init(
         QueryInterface: { IBaseOverridesWrapper.queryInterface($0, $1, $2) },
-        AddRef: { IBaseOverridesWrapper.addRef($0) },
-        Release: { IBaseOverridesWrapper.release($0) },
+        AddRef: { IBaseOverridesWrapper.addRefAggregated($0) },
+        Release: { IBaseOverridesWrapper.releaseAggregated($0) },
         GetIids: {
             let size = MemoryLayout<WindowsFoundation.IID>.size
             let iids = CoTaskMemAlloc(UInt64(size) * 3).assumingMemoryBound(to: WindowsFoundation.IID.self)
@@ -3607,9 +3706,10 @@ extension __ABI_test_component {
 
         public func CreateFromString(_ value: String) throws -> test_component.Base? {
             let (result) = try ComPtrs.initialize { resultAbi in
-                let _value = try! HString(value)
-                _ = try perform(as: __x_ABI_Ctest__component_CIBaseStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFromString(pThis, _value.get(), &resultAbi))
+                try value.withHStringRef { _value in
+                    _ = try perform(as: __x_ABI_Ctest__component_CIBaseStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFromString(pThis, _value, &resultAbi))
+                    }
                 }
             }
             return __IMPL_test_component.BaseBridge.from(abi: result)
@@ -3679,6 +3779,9 @@ open class BaseCollection : WinRTClass, IVector, IIterable {
         return Int(index)
     }
     public var count: Int { Int(size) }
+    public func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
 
     public subscript(position: Int) -> Element {
@@ -4024,9 +4127,10 @@ extension __ABI_test_component {
 
         public func CreateFromString(_ value: String) throws -> test_component.BaseNoOverrides? {
             let (result) = try ComPtrs.initialize { resultAbi in
-                let _value = try! HString(value)
-                _ = try perform(as: __x_ABI_Ctest__component_CIBaseNoOverridesStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFromString(pThis, _value.get(), &resultAbi))
+                try value.withHStringRef { _value in
+                    _ = try perform(as: __x_ABI_Ctest__component_CIBaseNoOverridesStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFromString(pThis, _value, &resultAbi))
+                    }
                 }
             }
             return __IMPL_test_component.BaseNoOverridesBridge.from(abi: result)
@@ -4073,6 +4177,9 @@ public final class BaseObservableCollection : WinRTClass, IObservableVector, IVe
         return Int(index)
     }
     public var count: Int { Int(size) }
+    public func makeIterator() -> WindowsFoundation.VectorIterator<Element> {
+        .init(self, placeholder: nil)
+    }
 
 
     public subscript(position: Int) -> Element {
@@ -4091,12 +4198,13 @@ public final class BaseObservableCollection : WinRTClass, IObservableVector, IVe
     // MARK: WinRT
     public lazy var vectorChanged : Event<VectorChangedEventHandler<Base?>> = {
       .init(
+        bridge: test_component.__x_ABI_C__FVectorChangedEventHandler_1___x_ABI_Ctest__zcomponent__CBaseBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_VectorChanged($0)
+          return try this.add_VectorChanged($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_VectorChanged($0)
+         try self?._default.remove_VectorChanged($0)
        }
       )
     }()
@@ -4440,12 +4548,13 @@ public final class Class : WinRTClass, IBasic {
 
     public lazy var deferrableEvent : Event<TypedEventHandler<Class?, DeferrableEventArgs?>> = {
       .init(
+        bridge: test_component.__x_ABI_C__FITypedEventHandler_2___x_ABI_Ctest__zcomponent__CClass___x_ABI_Ctest__zcomponent__CDeferrableEventArgsBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_DeferrableEvent($0)
+          return try this.add_DeferrableEvent($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_DeferrableEvent($0)
+         try self?._default.remove_DeferrableEvent($0)
        }
       )
     }()
@@ -4526,9 +4635,10 @@ extension __ABI_test_component {
         }
 
         public func Fail(_ message: String) throws {
-            let _message = try! HString(message)
-            _ = try perform(as: __x_ABI_Ctest__component_CIClass.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.Fail(pThis, _message.get()))
+            try message.withHStringRef { _message in
+                _ = try perform(as: __x_ABI_Ctest__component_CIClass.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.Fail(pThis, _message))
+                }
             }
         }
 
@@ -4543,9 +4653,10 @@ extension __ABI_test_component {
 
         public func InString(_ value: String) throws -> String {
             var result: HSTRING?
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_Ctest__component_CIClass.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.InString(pThis, _value.get(), &result))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_Ctest__component_CIClass.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.InString(pThis, _value, &result))
+                }
             }
             defer { WindowsDeleteString(result) }
             return .init(from: result)
@@ -4717,6 +4828,15 @@ extension __ABI_test_component {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_DeferrableEvent(_ handler: UnsafeMutablePointer<__x_ABI_C__FITypedEventHandler_2___x_ABI_Ctest__zcomponent__CClass___x_ABI_Ctest__zcomponent__CDeferrableEventArgs>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_Ctest__component_CIClass.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_DeferrableEvent(pThis, handler, &token))
+            }
+            return token
+        }
+
         public func remove_DeferrableEvent(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_Ctest__component_CIClass.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_DeferrableEvent(pThis, token))
@@ -4832,9 +4952,10 @@ extension __ABI_test_component {
 
         public func CreateInstance(_ name: String) throws -> IClass {
             let (value) = try ComPtrs.initialize { valueAbi in
-                let _name = try! HString(name)
-                _ = try perform(as: __x_ABI_Ctest__component_CIClassFactory.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateInstance(pThis, _name.get(), &valueAbi))
+                try name.withHStringRef { _name in
+                    _ = try perform(as: __x_ABI_Ctest__component_CIClassFactory.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateInstance(pThis, _name, &valueAbi))
+                    }
                 }
             }
             return IClass(value!)
@@ -4842,9 +4963,10 @@ extension __ABI_test_component {
 
         public func CreateInstance2(_ name: String, _ fruit: test_component.Fruit) throws -> IClass {
             let (value) = try ComPtrs.initialize { valueAbi in
-                let _name = try! HString(name)
-                _ = try perform(as: __x_ABI_Ctest__component_CIClassFactory.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateInstance2(pThis, _name.get(), fruit, &valueAbi))
+                try name.withHStringRef { _name in
+                    _ = try perform(as: __x_ABI_Ctest__component_CIClassFactory.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateInstance2(pThis, _name, fruit, &valueAbi))
+                    }
                 }
             }
             return IClass(value!)
@@ -4905,11 +5027,12 @@ extension __ABI_test_component {
 
         public func CreateInstance(_ name: String, _ fruit: test_component.Fruit, _ implementation: test_component.AnyIIAmImplementable?) throws -> IClass {
             let (value) = try ComPtrs.initialize { valueAbi in
-                let _name = try! HString(name)
-                let implementationWrapper = __ABI_test_component.IIAmImplementableWrapper(implementation)
-                let _implementation = try! implementationWrapper?.toABI { $0 }
-                _ = try perform(as: __x_ABI_Ctest__component_CIClassFactory2.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateInstance(pThis, _name.get(), fruit, _implementation, &valueAbi))
+                try name.withHStringRef { _name in
+                    let implementationWrapper = __ABI_test_component.IIAmImplementableWrapper(implementation)
+                    let _implementation = try! implementationWrapper?.toABI { $0 }
+                    _ = try perform(as: __x_ABI_Ctest__component_CIClassFactory2.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateInstance(pThis, _name, fruit, _implementation, &valueAbi))
+                    }
                 }
             }
             return IClass(value!)
@@ -5349,9 +5472,10 @@ extension __ABI_test_component {
 
         public func CreateFromString(_ value: String) throws -> test_component.Derived? {
             let (result) = try ComPtrs.initialize { resultAbi in
-                let _value = try! HString(value)
-                _ = try perform(as: __x_ABI_Ctest__component_CIDerivedStatics.self) { pThis in
-                    try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFromString(pThis, _value.get(), &resultAbi))
+                try value.withHStringRef { _value in
+                    _ = try perform(as: __x_ABI_Ctest__component_CIDerivedStatics.self) { pThis in
+                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateFromString(pThis, _value, &resultAbi))
+                    }
                 }
             }
             return __IMPL_test_component.DerivedBridge.from(abi: result)
@@ -5879,8 +6003,9 @@ public final class Simple : WinRTClass {
 
     public static var staticEvent : Event<EventHandler<Any?>> = {
       .init(
-        add: { try! _ISimpleStatics.add_StaticEvent($0) },
-        remove: { try? _ISimpleStatics.remove_StaticEvent($0) }
+        bridge: test_component.__x_ABI_C__FIEventHandler_1_IInspectableBridge.self,
+        add: { try _ISimpleStatics.add_StaticEvent($0) },
+        remove: { try _ISimpleStatics.remove_StaticEvent($0) }
       )
     }()
 
@@ -5950,36 +6075,39 @@ public final class Simple : WinRTClass {
 
     public lazy var inEvent : Event<test_component.InDelegate> = {
       .init(
+        bridge: __IMPL_test_component_Delegates.InDelegateBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_InEvent($0)
+          return try this.add_InEvent($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_InEvent($0)
+         try self?._default.remove_InEvent($0)
        }
       )
     }()
 
     public lazy var signalEvent : Event<test_component.SignalDelegate> = {
       .init(
+        bridge: __IMPL_test_component_Delegates.SignalDelegateBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_SignalEvent($0)
+          return try this.add_SignalEvent($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_SignalEvent($0)
+         try self?._default.remove_SignalEvent($0)
        }
       )
     }()
 
     public lazy var simpleEvent : Event<TypedEventHandler<Simple?, SimpleEventArgs>> = {
       .init(
+        bridge: test_component.__x_ABI_C__FITypedEventHandler_2___x_ABI_Ctest__zcomponent__CSimple___x_ABI_Ctest__zcomponent__CSimpleEventArgsBridge.self,
         add: { [weak self] in
           guard let this = self?._default else { return .init() }
-          return try! this.add_SimpleEvent($0)
+          return try this.add_SimpleEvent($0)
         },
         remove: { [weak self] in
-         try? self?._default.remove_SimpleEvent($0)
+         try self?._default.remove_SimpleEvent($0)
        }
       )
     }()
@@ -6150,9 +6278,10 @@ extension __ABI_test_component {
         }
 
         public func put_StringProperty(_ value: String) throws {
-            let _value = try! HString(value)
-            _ = try perform(as: __x_ABI_Ctest__component_CISimple.self) { pThis in
-                try CHECKED(pThis.pointee.lpVtbl.pointee.put_StringProperty(pThis, _value.get()))
+            try value.withHStringRef { _value in
+                _ = try perform(as: __x_ABI_Ctest__component_CISimple.self) { pThis in
+                    try CHECKED(pThis.pointee.lpVtbl.pointee.put_StringProperty(pThis, _value))
+                }
             }
         }
 
@@ -6166,6 +6295,15 @@ extension __ABI_test_component {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_SignalEvent(_ handler: UnsafeMutablePointer<__x_ABI_Ctest__component_CDelegates_CISignalDelegate>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_Ctest__component_CISimple.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_SignalEvent(pThis, handler, &token))
+            }
+            return token
+        }
+
         public func remove_SignalEvent(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_Ctest__component_CISimple.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_SignalEvent(pThis, token))
@@ -6182,6 +6320,15 @@ extension __ABI_test_component {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_InEvent(_ handler: UnsafeMutablePointer<__x_ABI_Ctest__component_CDelegates_CIInDelegate>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_Ctest__component_CISimple.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_InEvent(pThis, handler, &token))
+            }
+            return token
+        }
+
         public func remove_InEvent(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_Ctest__component_CISimple.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_InEvent(pThis, token))
@@ -6198,6 +6345,15 @@ extension __ABI_test_component {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_SimpleEvent(_ handler: UnsafeMutablePointer<__x_ABI_C__FITypedEventHandler_2___x_ABI_Ctest__zcomponent__CSimple___x_ABI_Ctest__zcomponent__CSimpleEventArgs>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_Ctest__component_CISimple.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_SimpleEvent(pThis, handler, &token))
+            }
+            return token
+        }
+
         public func remove_SimpleEvent(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_Ctest__component_CISimple.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_SimpleEvent(pThis, token))
@@ -6244,6 +6400,15 @@ extension __ABI_test_component {
             return token
         }
 
+        @_spi(WinRTInternal)
+        public func add_StaticEvent(_ handler: UnsafeMutablePointer<__x_ABI_C__FIEventHandler_1_IInspectable>?) throws -> EventRegistrationToken {
+            var token: EventRegistrationToken = .init()
+            _ = try perform(as: __x_ABI_Ctest__component_CISimpleStatics.self) { pThis in
+                try CHECKED(pThis.pointee.lpVtbl.pointee.add_StaticEvent(pThis, handler, &token))
+            }
+            return token
+        }
+
         public func remove_StaticEvent(_ token: EventRegistrationToken) throws {
             _ = try perform(as: __x_ABI_Ctest__component_CISimpleStatics.self) { pThis in
                 try CHECKED(pThis.pointee.lpVtbl.pointee.remove_StaticEvent(pThis, token))
@@ -6362,15 +6527,20 @@ open class UnsealedDerived : test_component.Base {
         super.init(composing: composing, createCallback)
     }
     override open func queryInterface(_ iid: WindowsFoundation.IID) -> IUnknownRef? {
-        switch iid {
-            case __ABI_test_component.IUnsealedDerivedOverloads2Wrapper.IID:
-                let wrapper = __ABI_test_component.IUnsealedDerivedOverloads2Wrapper(self)
-                return wrapper!.queryInterface(iid)
-            case __ABI_test_component.IUnsealedDerivedOverridesWrapper.IID:
-                let wrapper = __ABI_test_component.IUnsealedDerivedOverridesWrapper(self)
-                return wrapper!.queryInterface(iid)
-            default: return super.queryInterface(iid)
+        switch iid.Data1 {
+            case 0x828DCEE6:
+                if iid == __ABI_test_component.IUnsealedDerivedOverridesWrapper.IID {
+                    let wrapper = __ABI_test_component.IUnsealedDerivedOverridesWrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            case 0xF4CE1AD9:
+                if iid == __ABI_test_component.IUnsealedDerivedOverloads2Wrapper.IID {
+                    let wrapper = __ABI_test_component.IUnsealedDerivedOverloads2Wrapper(self)
+                    return wrapper!.queryInterface(iid)
+                }
+            default: break
         }
+        return super.queryInterface(iid)
     }
     private static var _IUnsealedDerivedFactory : __ABI_test_component.IUnsealedDerivedFactory =  try! RoGetActivationFactory("test_component.UnsealedDerived")
 
@@ -6462,8 +6632,8 @@ extension __ABI_test_component {
     internal typealias IUnsealedDerivedOverridesWrapper = UnsealedWinRTClassWrapper<__IMPL_test_component.UnsealedDerivedBridge.IUnsealedDerivedOverrides>
     internal static var IUnsealedDerivedOverridesVTable: __x_ABI_Ctest__component_CIUnsealedDerivedOverridesVtbl = .init(
         QueryInterface: { IUnsealedDerivedOverridesWrapper.queryInterface($0, $1, $2) },
-        AddRef: { IUnsealedDerivedOverridesWrapper.addRef($0) },
-        Release: { IUnsealedDerivedOverridesWrapper.release($0) },
+        AddRef: { IUnsealedDerivedOverridesWrapper.addRefAggregated($0) },
+        Release: { IUnsealedDerivedOverridesWrapper.releaseAggregated($0) },
         GetIids: {
             let size = MemoryLayout<WindowsFoundation.IID>.size
             let iids = CoTaskMemAlloc(UInt64(size) * 4).assumingMemoryBound(to: WindowsFoundation.IID.self)
@@ -6500,8 +6670,8 @@ extension __ABI_test_component {
     internal typealias IUnsealedDerivedOverloads2Wrapper = UnsealedWinRTClassWrapper<__IMPL_test_component.UnsealedDerivedBridge.IUnsealedDerivedOverloads2>
     internal static var IUnsealedDerivedOverloads2VTable: __x_ABI_Ctest__component_CIUnsealedDerivedOverloads2Vtbl = .init(
         QueryInterface: { IUnsealedDerivedOverloads2Wrapper.queryInterface($0, $1, $2) },
-        AddRef: { IUnsealedDerivedOverloads2Wrapper.addRef($0) },
-        Release: { IUnsealedDerivedOverloads2Wrapper.release($0) },
+        AddRef: { IUnsealedDerivedOverloads2Wrapper.addRefAggregated($0) },
+        Release: { IUnsealedDerivedOverloads2Wrapper.releaseAggregated($0) },
         GetIids: {
             let size = MemoryLayout<WindowsFoundation.IID>.size
             let iids = CoTaskMemAlloc(UInt64(size) * 5).assumingMemoryBound(to: WindowsFoundation.IID.self)
@@ -6624,12 +6794,13 @@ extension __ABI_test_component {
 
         public func CreateInstance3(_ prop1: String, _ prop2: test_component.Base?, _ baseInterface: UnsealedWinRTClassWrapper<__IMPL_test_component.UnsealedDerivedBridge.Composable>?, _ innerInterface: inout WindowsFoundation.IInspectable?) throws -> IUnsealedDerived {
             let (value) = try ComPtrs.initialize { valueAbi in
-                let _prop1 = try! HString(prop1)
-                let _baseInterface = baseInterface?.toIInspectableABI { $0 }
-                let (_innerInterface) = try ComPtrs.initialize { _innerInterfaceAbi in
-                    _ = try perform(as: __x_ABI_Ctest__component_CIUnsealedDerivedFactory.self) { pThis in
-                        try CHECKED(pThis.pointee.lpVtbl.pointee.CreateInstance3(pThis, _prop1.get(), RawPointer(prop2), _baseInterface, &_innerInterfaceAbi, &valueAbi))
-                    }
+                try prop1.withHStringRef { _prop1 in
+                    let _baseInterface = baseInterface?.toIInspectableABI { $0 }
+                    let (_innerInterface) = try ComPtrs.initialize { _innerInterfaceAbi in
+                        _ = try perform(as: __x_ABI_Ctest__component_CIUnsealedDerivedFactory.self) { pThis in
+                            try CHECKED(pThis.pointee.lpVtbl.pointee.CreateInstance3(pThis, _prop1, RawPointer(prop2), _baseInterface, &_innerInterfaceAbi, &valueAbi))
+                        }
+                }
                 }
                 innerInterface = WindowsFoundation.IInspectable(_innerInterface!)
             }